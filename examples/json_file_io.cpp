@@ -1,5 +1,4 @@
 #include <ccjson.h>
-#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -7,22 +6,10 @@ using namespace ccjson;
 
 int main() {
     try {
-        // 读取twitter.json文件
-        std::ifstream input_file("twitter.json");
-        if (!input_file.is_open()) {
-            std::cerr << "Error: Could not open twitter.json" << std::endl;
-            return 1;
-        }
-
-        // 将文件内容读入字符串
-        std::string json_str((std::istreambuf_iterator<char>(input_file)),
-                             std::istreambuf_iterator<char>());
-        input_file.close();
-
-        // 解析JSON
+        // 解析JSON（文件被映射到内存后直接解析，不需要先读入字符串）
         JsonValue json;
         try {
-            json = parser::parse(json_str);
+            json = parser::parseFile("twitter.json");
             std::cout << "Successfully parsed twitter.json" << '\n';
 
             // 打印JSON内容
@@ -6,14 +6,23 @@
 
 #    define CCJSON_JSON_H
 
+#    include <cstring>
+#    include <deque>
+#    include <functional>
+#    include <iosfwd>
+#    include <iterator>
 #    include <map>
 #    include <memory>
+#    include <memory_resource>
+#    include <mutex>
 #    include <optional>
 #    include <ostream>
 #    include <stdexcept>
 #    include <string>
+#    include <string_view>
 #    include <type_traits>
 #    include <unordered_map>
+#    include <unordered_set>
 #    include <utility>
 #    include <variant>
 #    include <vector>
@@ -22,6 +31,8 @@ namespace ccjson {
 
 // 前向声明
 class JsonValue;
+class Document;
+class StringPool;
 
 /**
  * @enum JsonType
@@ -29,7 +40,7 @@ class JsonValue;
  *
  * 枚举了 JSON 值的所有可能类型，包括空值、布尔值、整数、浮点数、字符串、数组和对象。
  */
-enum class JsonType {
+enum class JsonType : uint8_t {
     Null,     ///< 空值
     Boolean,  ///< 布尔值
     Integer,  ///< 整数
@@ -50,6 +61,70 @@ class JsonException : public std::runtime_error {
     using std::runtime_error::runtime_error;
 };
 
+/**
+ * @enum ParseErrorCode
+ * @brief 解析错误的类型。
+ */
+enum class ParseErrorCode : uint8_t {
+    None,                     ///< 没有错误
+    UnexpectedEndOfInput,     ///< 输入提前结束
+    UnexpectedEndOfArray,     ///< 数组没有结束
+    UnexpectedEndOfObject,    ///< 对象没有结束（或键之后缺少 ':'）
+    UnexpectedEndOfString,    ///< 字符串没有结束
+    UnexpectedCharacter,      ///< 值不能以该字符开头
+    UnexpectedContent,        ///< 根节点之后还有其他内容
+    ExpectedNull,             ///< 不是 null
+    ExpectedBoolean,          ///< 不是 true 或 false
+    ExpectedArraySeparator,   ///< 数组元素之后不是 ',' 或 ']'
+    ExpectedObjectSeparator,  ///< 对象成员之后不是 ',' 或 '}'
+    KeyNotString,             ///< 对象的键不是字符串
+    MaxDepthExceeded,         ///< 嵌套深度超过 maxDepth
+    SignBeforePoint,          ///< 符号之后紧跟小数点（如 "-.5"）
+    LeadingZero,              ///< 整数部分有前导零（如 "012"）
+    MissingFraction,          ///< 小数点之后没有数字
+    MissingExponent,          ///< 指数部分没有数字
+    InvalidInteger,           ///< 整数没有整数部分（如 "-"）
+    InvalidFloat,             ///< 浮点数没有整数部分（如 "-e5"）
+    NumberOutOfRange,         ///< 超出 double 的表示范围
+    ControlCharacter,         ///< 字符串中有未转义的控制字符
+    InvalidEscape,            ///< 无效的转义序列
+    InvalidUnicodeEscape,     ///< 无效的 \u 转义
+    MissingLowSurrogate,      ///< UTF-16 代理对缺少低代理
+    InvalidLowSurrogate,      ///< UTF-16 代理对的低代理无效
+    InvalidCodePoint,         ///< 无效的 Unicode 码点
+    XEscapeDisabled,          ///< 未启用 \x 转义
+    InvalidXEscape,           ///< 无效的 \x 转义
+    InvalidXEscapeSize,       ///< \x 转义的字节数无效
+    InvalidXEscapeUtf8,       ///< \x 转义的字节不是有效的 UTF-8
+    InvalidZeroEscape,        ///< 未启用 \0 转义
+    InvalidUtf8               ///< 无效的 UTF-8 字节序列（只有 validate 检查）
+};
+
+/**
+ * @struct ParseError
+ * @brief 不抛出异常的解析接口报告的错误：错误类型和位置。
+ *
+ * 只记录错误类型和位置，错误描述在调用 message() 时才生成。
+ */
+struct ParseError {
+    ParseErrorCode code      = ParseErrorCode::None;  ///< 错误类型
+    size_t         offset    = 0;                     ///< 出错的字符位置
+    char           character = 0;                     ///< UnexpectedCharacter 时的字符
+
+    /**
+     * @brief 是否有错误。
+     */
+    explicit operator bool() const noexcept {
+        return code != ParseErrorCode::None;
+    }
+
+    /**
+     * @brief 生成不含位置信息的错误描述（与 JsonParseException::message() 相同）
+     * @return 错误描述信息。
+     */
+    std::string message() const;
+};
+
 /**
  * @class JsonParseException
  * @brief JSON 解析过程中的异常类。
@@ -64,7 +139,29 @@ class JsonParseException : public std::runtime_error {
      * @param position 解析失败的字符位置。
      */
     JsonParseException(const std::string& message, size_t position)
-        : std::runtime_error(message + ", position: " + std::to_string(position)) {}
+        : std::runtime_error(message + ", position: " + std::to_string(position)),
+          m_length(message.size()),
+          m_position(position) {}
+
+    /**
+     * @brief 获取不含位置信息的错误描述。
+     * @return 错误描述信息。
+     */
+    std::string message() const {
+        return std::string(what(), m_length);
+    }
+
+    /**
+     * @brief 获取解析失败的字符位置。
+     * @return 字符位置。
+     */
+    size_t position() const noexcept {
+        return m_position;
+    }
+
+  private:
+    size_t m_length;    ///< 错误描述的长度
+    size_t m_position;  ///< 解析失败的字符位置
 };
 
 /**
@@ -124,603 +221,1601 @@ using JsonString = std::string;
 /**
  * @brief JSON 数组类型别名。
  *
- * 使用 std::vector<JsonValue> 作为 JSON 数组的存储类型。
- */
-using JsonArray = std::vector<JsonValue>;
-/**
- * @brief JSON 对象类型别名。
- *
- * 使用 std::map<std::string, JsonValue> 作为 JSON 对象的存储类型。
+ * 使用 std::pmr::vector<JsonValue> 作为 JSON 数组的存储类型：默认从 std::pmr::get_default_resource()
+ * 分配，parser::ENABLE_ARENA 解析得到的数组从 Document 的 arena 中分配。
+ * 拷贝得到的数组总是使用默认的内存资源。
  */
-using JsonObject = std::map<std::string, JsonValue>;
+using JsonArray = std::pmr::vector<JsonValue>;
 
-// 容器序列化支持
+class JsonObjectKey;
 
 /**
- * @brief JSON 对象反序列化为 std::vector
- * @tparam T 向量元素的类型
- * @param root 要反序列化的 JSON 对象
- * @param vec 反序列化后的 std::vector 对象
- * @note 如果 T 支持 fromJson函数，则使用 fromJson 进行反序列化；否则直接构造 JsonValue
+ * @struct IsKeyComparable
+ * @brief 判断类型 T 是否为可以与 JsonObjectKey 直接比较的字符串类型（不包括 JsonObjectKey 本身）
+ * @tparam T 要检查的类型。
  */
 template <typename T>
-void fromJson(const JsonValue& root, std::vector<T>& vec);
-
-/**
- * @brief 将 JSON 对象反序列化为键为字符串的映射
- * @tparam Map 映射类型（std::map 或 std::unordered_map）
- * @tparam T 映射值的类型
- * @tparam S SFINAE 约束，确保键类型为 std::string 且 Map 为 std::map 或 std::unordered_map
- * @param root 要反序列化的 JSON 对象
- * @param map 反序列化后的映射对象
- * @note 如果值类型支持 fromJson 函数，则使用 fromJson 反序列化；否则直接构造 JsonValue
- */
-template <typename Map,
-          typename T = typename Map::mapped_type,
-          typename S = std::enable_if_t<std::is_same_v<typename Map::key_type, std::string> &&
-                                        (std::is_same_v<Map, std::map<std::string, T>> ||
-                                         std::is_same_v<Map, std::unordered_map<std::string, T>>)>>
-void fromJson(const JsonValue& root, Map& map);
+struct IsKeyComparable : std::bool_constant<std::is_convertible_v<const T&, std::string_view> &&
+                                            !std::is_same_v<T, JsonObjectKey>> {};
 
 /**
- * @brief 将 std::vector 序列化为 JSON 对象
- * @tparam T 向量元素的类型
- * @param vec 要序列化的向量
- * @return 表示 JSON 数组的 JsonValue 对象
- * @note 如果元素类型支持 toJson 函数，则使用 toJson 序列化；否则直接构造 JsonValue
+ * @struct IsObjectKey
+ * @brief 判断类型 T 能否作为对象的键查找（可以转换为 std::string_view 的非整数类型，
+ *        包括 JsonObjectKey 与 JsonKey）
+ * @tparam T 要检查的类型（可以带引用与 cv 限定）
  */
 template <typename T>
-JsonValue toJson(const std::vector<T>& vec);
-
-/**
- * @brief 将键为字符串的映射序列化为 JSON 对象
- * @tparam Map 映射类型（std::map 或 std::unordered_map）
- * @tparam T 映射值的类型
- * @tparam S SFINAE 约束，确保键类型为 std::string 且 Map 为 std::map 或 std::unordered_map
- * @param map 要序列化的映射
- * @return 表示 JSON 对象的 JsonValue 对象
- * @note 如果值类型支持 toJson 函数，则使用 toJson 序列化；否则直接构造 JsonValue
- */
-template <typename Map,
-          typename T = typename Map::mapped_type,
-          typename S = std::enable_if_t<std::is_same_v<typename Map::key_type, std::string> &&
-                                        (std::is_same_v<Map, std::map<std::string, T>> ||
-                                         std::is_same_v<Map, std::unordered_map<std::string, T>>)>>
-JsonValue toJson(const Map& map);
+struct IsObjectKey
+    : std::bool_constant<!std::is_integral_v<std::remove_reference_t<T>> &&
+                         std::is_convertible_v<const std::decay_t<T>&, std::string_view>> {};
 
 /**
- * @class JsonValue
- * @brief 表示 JSON 数据的核心类，支持多种 JSON 数据类型。
- *
- * 该类封装了 JSON 的基本数据类型（空值、布尔值、整数、浮点数、字符串、数组、对象），
- * 提供构造、赋值、类型检查和数据访问等功能。支持动态类型转换和容器序列化。
+ * @class JsonObjectKey
+ * @brief JSON 对象的键。
  *
- * @note 该类使用联合体存储不同类型的值
+ * 固定为 16 字节：不超过 INLINE_CAPACITY 字节的键直接保存在键内部，较长的键持有单独分配的副本；
+ * parser::parseDocument 得到的文档中，没有转义字符的键直接引用输入缓冲区，不做复制。
+ * 拷贝时总是得到持有内容的副本，移动时保留对缓冲区的引用。
+ * 可以隐式转换为 std::string 与 std::string_view，并可以直接与字符串比较。
  */
-class JsonValue {
+class JsonObjectKey {
   public:
-    /**
-     * @brief 默认构造函数，初始化为空值（Null）
-     */
-    JsonValue() noexcept : m_type(JsonType::Null) {}
+    /// 直接保存在键内部的最大字节数
+    static constexpr size_t INLINE_CAPACITY = 15;
 
     /**
-     * @brief 构造空值类型的 JSON 数据。
-     * @param value 空值（std::nullptr_t）
+     * @brief 构造空键。
      */
-    JsonValue(std::nullptr_t) noexcept : m_type(JsonType::Null) {}
+    JsonObjectKey() noexcept = default;
 
     /**
-     * @brief 构造布尔类型的 JSON 数据。
-     * @param value 布尔值（true 或 false）
+     * @brief 由字符串构造键（复制内容，持有字符串）
+     * @param key 键。
      */
-    JsonValue(bool value) noexcept : m_type(JsonType::Boolean) {
-        m_value.boolean = value;
+    JsonObjectKey(const std::string& key) {
+        assign(key);
     }
 
     /**
-     * @brief 构造整数类型的 JSON 数据。
-     * @tparam T 整数类型（例如 int32_t、int64_t 等，非 bool）
-     * @param value 整数值。
+     * @brief 由 C 风格字符串构造键（持有字符串）
+     * @param key 键。
      */
-    template <typename T,
-              std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
-    JsonValue(T value) noexcept : m_type(JsonType::Integer) {
-        m_value.iNumber = static_cast<int64_t>(value);
+    JsonObjectKey(const char* key) {
+        assign(key);
     }
 
     /**
-     * @brief 构造浮点数类型的 JSON 数据。
-     * @tparam T 浮点数类型（例如 float、double）
-     * @param value 浮点数值。
+     * @brief 由字符串视图构造键（复制内容，持有字符串）
+     * @param key 键。
      */
-    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
-    JsonValue(T value) noexcept : m_type(JsonType::Double) {
-        m_value.dNumber = static_cast<double>(value);
+    explicit JsonObjectKey(std::string_view key) {
+        assign(key);
     }
 
     /**
-     * @brief 构造字符串类型的 JSON 数据 (高级 SFINAE 版本)
-     * @param value 任何类似字符串的类型
+     * @brief 创建引用外部内存的键，不复制内容。
+     * @param key 键，其引用的内存必须在键的整个生命周期内有效。
+     * @return 引用 key 的 JsonObjectKey。
+     * @exception JsonException 键的长度超过 4 GB 时抛出异常。
      */
-    template <typename T,
-              // SFINAE 约束条件
-              typename = std::enable_if_t<
-                  // 1. 类型 T 可以转换为 std::string_view
-                  std::is_convertible_v<const std::decay_t<T>&, std::string_view> &&
-                  // 2. 并且，类型 T 不是 JsonValue
-                  !std::is_same_v<std::decay_t<T>, JsonValue>>>
-    JsonValue(T&& value) noexcept : m_type(JsonType::String) {
-        m_value.string = new JsonString(value);
-    }
-
-    JsonValue(JsonString&& value) noexcept : m_type(JsonType::String) {
-        m_value.string = new JsonString(std::move(value));
+    static JsonObjectKey borrow(std::string_view key) {
+        JsonObjectKey result;
+        result.m_data = key.data();
+        result.m_size = checkedSize(key.size());
+        result.m_tag  = Borrowed;
+        return result;
     }
 
     /**
-     * @brief 构造数组类型的 JSON 数据。
-     * @param value JSON 数组对象。
+     * @brief 拷贝构造函数，总是复制键的内容。
      */
-    JsonValue(const JsonArray& value) noexcept : m_type(JsonType::Array) {
-        m_value.array = new JsonArray(value);
+    JsonObjectKey(const JsonObjectKey& other) {
+        assign(other.view());
     }
 
     /**
-     * @brief 构造对象类型的 JSON 数据。
-     * @param value JSON 对象（键值对映射）
+     * @brief 移动构造函数，引用外部内存的键移动后仍然引用同一块内存。
      */
-    JsonValue(const JsonObject& value) noexcept : m_type(JsonType::Object) {
-        m_value.object = new JsonObject(value);
+    JsonObjectKey(JsonObjectKey&& other) noexcept {
+        std::memcpy(static_cast<void*>(this), &other, sizeof(JsonObjectKey));
+        other.m_tag = 0;
     }
 
     /**
-     * @brief 构造数组类型的 JSON 数据（std::vector）
-     * @tparam T 向量元素的类型。
-     * @param vec 向量对象。
+     * @brief 拷贝赋值运算符，总是复制键的内容。
      */
-    template <typename T>
-    JsonValue(const std::vector<T>& vec) : m_type(JsonType::Array) {
-        *this = toJson(vec);
+    JsonObjectKey& operator=(const JsonObjectKey& other) {
+        if (this != &other) {
+            *this = JsonObjectKey(other.view());
+        }
+        return *this;
     }
 
     /**
-     * @brief 构造对象类型的 JSON 数据（std::map）
-     * @tparam T 映射值的类型。
-     * @param map 映射对象。
+     * @brief 移动赋值运算符。
      */
-    template <typename T>
-    JsonValue(const std::map<std::string, T>& map) : m_type(JsonType::Object) {
-        *this = toJson(map);
+    JsonObjectKey& operator=(JsonObjectKey&& other) noexcept {
+        if (this != &other) {
+            release();
+            std::memcpy(static_cast<void*>(this), &other, sizeof(JsonObjectKey));
+            other.m_tag = 0;
+        }
+        return *this;
     }
 
-    /**
-     * @brief 构造对象类型的 JSON 数据（std::unordered_map）
-     * @tparam T 映射值的类型。
-     * @param map 无序映射对象。
-     */
-    template <typename T>
-    JsonValue(const std::unordered_map<std::string, T>& map) : m_type(JsonType::Object) {
-        *this = toJson(map);
+    ~JsonObjectKey() {
+        release();
     }
 
     /**
-     * @brief 使用初始化列表构造对象类型的 JSON 数据。
-     * @tparam T 值类型。
-     * @param init 初始化列表，包含键值对（const char*, T）
+     * @brief 获取键的内容。
+     * @return 指向键内容的字符串视图。
      */
-    template <typename T>
-    JsonValue(std::initializer_list<std::pair<const char*, T>> init) : m_type(JsonType::Object) {
-        m_value.object = new JsonObject();
-        for (const auto& [k, v] : init) {
-            (*m_value.object)[k] = JsonValue(v);
+    std::string_view view() const noexcept {
+        if (m_tag < Heap) {
+            return {reinterpret_cast<const char*>(this), m_tag};
         }
+        return {m_data, m_size};
     }
 
     /**
-     * @brief 使用初始化列表构造对象类型的 JSON 数据（JsonValue 值）
-     * @param init 初始化列表，包含键值对（const char*, JsonValue）
+     * @brief 获取键的内容（复制为 std::string）
+     * @return 键的副本。
      */
-    JsonValue(std::initializer_list<std::pair<const char*, JsonValue>> init)
-        : m_type(JsonType::Object) {
-        m_value.object = new JsonObject();
-        for (const auto& [k, v] : init) {
-            (*m_value.object)[k] = v;
-        }
+    std::string str() const {
+        return std::string(view());
     }
 
     /**
-     * @brief 使用初始化列表构造对象类型的 JSON 数据（通用类型，转换为键值对）
-     * @tparam T 初始化列表元素类型（需可转换为 std::pair&lt;const char*, JsonValue&gt;）
-     * @param init 初始化列表。
+     * @brief 键是否引用外部内存。
+     * @return 引用外部内存时返回 true。
      */
-    template <
-        typename T,
-        std::enable_if_t<std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
-    JsonValue(std::initializer_list<T> init) {
-        // 对象初始化
-        m_type         = JsonType::Object;
-        m_value.object = new JsonObject();
-        for (const auto& item : init) {
-            auto pair                     = static_cast<std::pair<const char*, JsonValue>>(item);
-            (*m_value.object)[pair.first] = pair.second;
-        }
+    bool isBorrowed() const noexcept {
+        return m_tag == Borrowed;
     }
 
     /**
-     * @brief 使用初始化列表构造数组类型的 JSON 数据。
-     * @param init 初始化列表，包含非键值对的元素。
+     * @brief 获取键的长度。
+     * @return 键的字节数。
      */
-    template <
-        typename T,
-        std::enable_if_t<!std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
-    JsonValue(std::initializer_list<T> init) {
-        // 数组初始化
-        m_type        = JsonType::Array;
-        m_value.array = new JsonArray();
-        m_value.array->reserve(init.size());
-        for (const auto& item : init) {
-            m_value.array->emplace_back(JsonValue(item));
-        }
+    size_t size() const noexcept {
+        return view().size();
     }
 
     /**
-     * @brief 拷贝构造函数。
+     * @brief 获取键的长度。
+     * @return 键的字节数。
      */
-    JsonValue(const JsonValue& other);
+    size_t length() const noexcept {
+        return view().size();
+    }
 
     /**
-     * @brief 移动构造函数。
-     * @param other JsonValue 对象（右值）
+     * @brief 键是否为空字符串。
+     * @return 为空时返回 true。
      */
-    JsonValue(JsonValue&& other) noexcept;
+    bool empty() const noexcept {
+        return view().empty();
+    }
 
     /**
-     * @brief 拷贝赋值运算符。
-     * @param other 要赋值的 JsonValue 对象。
-     * @return 自身引用。
+     * @brief 获取键内容的指针。
+     * @return 指向键内容的指针（不保证以 '\0' 结尾）
      */
-    JsonValue& operator=(const JsonValue& other);
+    const char* data() const noexcept {
+        return view().data();
+    }
 
     /**
-     * @brief 移动赋值运算符。
-     * @param other JsonValue 对象（右值）
-     * @return 自身引用。
+     * @brief 转换为字符串视图。
      */
-    JsonValue& operator=(JsonValue&& other) noexcept;
+    operator std::string_view() const noexcept {
+        return view();
+    }
 
     /**
-     * @brief 析构函数，释放内部资源。
+     * @brief 转换为 std::string（复制内容）
      */
-    ~JsonValue();
+    operator std::string() const {
+        return str();
+    }
 
     /**
-     * @brief 获取 JSON 数据类型。
-     * @return 当前 JSON 值的类型（JsonType）
+     * @brief 比较两个键。
      */
-    inline JsonType type() const noexcept {
-        return m_type;
+    friend bool operator==(const JsonObjectKey& lhs, const JsonObjectKey& rhs) noexcept {
+        return lhs.view() == rhs.view();
     }
 
-    /**
-     * @brief 检查是否为空值（Null）
-     * @return 如果是空值，返回 true，否则返回 false。
-     */
-    inline bool isNull() const noexcept {
-        return m_type == JsonType::Null;
+    friend bool operator!=(const JsonObjectKey& lhs, const JsonObjectKey& rhs) noexcept {
+        return lhs.view() != rhs.view();
     }
 
-    /**
-     * @brief 检查是否为布尔类型。
-     * @return 如果是布尔值，返回 true，否则返回 false。
-     */
-    inline bool isBoolean() const noexcept {
-        return m_type == JsonType::Boolean;
+    friend bool operator<(const JsonObjectKey& lhs, const JsonObjectKey& rhs) noexcept {
+        return lhs.view() < rhs.view();
     }
 
     /**
-     * @brief 检查是否为数值类型（整数或浮点数）
-     * @return 如果是数值类型，返回 true，否则返回 false。
+     * @brief 与任意可以转换为 std::string_view 的字符串比较。
      */
-    inline bool isNumber() const noexcept {
-        return m_type == JsonType::Integer || m_type == JsonType::Double;
+    template <typename T, typename = std::enable_if_t<IsKeyComparable<T>::value>>
+    friend bool operator==(const JsonObjectKey& lhs, const T& rhs) noexcept {
+        return lhs.view() == std::string_view(rhs);
+    }
+
+    template <typename T, typename = std::enable_if_t<IsKeyComparable<T>::value>>
+    friend bool operator==(const T& lhs, const JsonObjectKey& rhs) noexcept {
+        return std::string_view(lhs) == rhs.view();
+    }
+
+    template <typename T, typename = std::enable_if_t<IsKeyComparable<T>::value>>
+    friend bool operator!=(const JsonObjectKey& lhs, const T& rhs) noexcept {
+        return lhs.view() != std::string_view(rhs);
+    }
+
+    template <typename T, typename = std::enable_if_t<IsKeyComparable<T>::value>>
+    friend bool operator!=(const T& lhs, const JsonObjectKey& rhs) noexcept {
+        return std::string_view(lhs) != rhs.view();
+    }
+
+    template <typename T, typename = std::enable_if_t<IsKeyComparable<T>::value>>
+    friend bool operator<(const JsonObjectKey& lhs, const T& rhs) noexcept {
+        return lhs.view() < std::string_view(rhs);
+    }
+
+    template <typename T, typename = std::enable_if_t<IsKeyComparable<T>::value>>
+    friend bool operator<(const T& lhs, const JsonObjectKey& rhs) noexcept {
+        return std::string_view(lhs) < rhs.view();
     }
 
     /**
-     * @brief 检查是否为字符串类型。
-     * @return 如果是字符串，返回 true，否则返回 false。
+     * @brief 输出键到流。
      */
-    inline bool isString() const noexcept {
-        return m_type == JsonType::String;
+    friend std::ostream& operator<<(std::ostream& os, const JsonObjectKey& key) {
+        return os << key.view();
     }
 
+  private:
+    /// m_tag 取值：小于 Heap 时为保存在内部的键的长度
+    static constexpr uint8_t Heap     = 0x10;  ///< m_data 指向持有的副本
+    static constexpr uint8_t Borrowed = 0x20;  ///< m_data 引用外部内存
+
     /**
-     * @brief 检查是否为数组类型。
-     * @return 如果是数组，返回 true，否则返回 false。
+     * @brief 检查键的长度能否用 32 位保存。
+     * @param size 键的字节数。
+     * @return 转换后的长度。
+     * @exception JsonException 超过 4 GB 时抛出异常。
      */
-    inline bool isArray() const noexcept {
-        return m_type == JsonType::Array;
+    static uint32_t checkedSize(size_t size) {
+        if (size > UINT32_MAX) {
+            throw JsonException("Object key too long");
+        }
+        return static_cast<uint32_t>(size);
     }
 
     /**
-     * @brief 检查是否为对象类型
-     * @return 如果是对象，返回 true，否则，返回 false
+     * @brief 设置空键的内容：较短的键复制到内部，较长的键复制到单独分配的内存。
+     * @param key 键。
      */
-    inline bool isObject() const noexcept {
-        return m_type == JsonType::Object;
+    void assign(std::string_view key) {
+        if (key.size() <= INLINE_CAPACITY) {
+            if (!key.empty()) {
+                std::memcpy(reinterpret_cast<char*>(this), key.data(), key.size());
+            }
+            m_tag = static_cast<uint8_t>(key.size());
+        } else {
+            m_size     = checkedSize(key.size());
+            auto* data = new char[key.size()];
+            std::memcpy(data, key.data(), key.size());
+            m_data = data;
+            m_tag  = Heap;
+        }
     }
 
     /**
-     * @brief 获取字符串值的引用
-     * @return 字符串值的引用
-     * @exception JsonException 如果当前类型不是字符串，抛出异常
+     * @brief 释放持有的副本。
      */
-    inline JsonString& asString() {
-        if (m_type != JsonType::String) {
-            throw JsonException("not a string");
+    void release() noexcept {
+        if (m_tag == Heap) {
+            delete[] m_data;
         }
-        return *m_value.string;
     }
 
+    // 保存在内部的键从对象起始位置开始，占用 m_data、m_size 与 m_padding
+    const char* m_data       = nullptr;  ///< 持有的副本或引用的外部内存
+    uint32_t    m_size       = 0;        ///< m_data 的长度
+    char        m_padding[3] = {};       ///< 保存在内部的键的最后 3 个字节
+    uint8_t     m_tag        = 0;        ///< 内部键的长度，或 Heap / Borrowed
+};
+
+static_assert(sizeof(JsonObjectKey) == 16, "JsonObjectKey must stay 16 bytes");
+static_assert(std::is_standard_layout_v<JsonObjectKey>, "inline keys rely on standard layout");
+
+/**
+ * @class JsonKey
+ * @brief 预先计算了哈希值的对象键，用于频繁查找的固定键。
+ *
+ * JsonObject 的查找接受字符串视图，不会构造临时的键；JsonKey 进一步省去每次查找时计算哈希值，
+ * 在建立了哈希索引的对象中，查找只需一次探测和一次键比较。例如：
+ * @code
+ * static const ccjson::JsonKey ID("id");
+ * int64_t id = status[ID].get<int64_t>();
+ * @endcode
+ * JsonKey 持有键的副本，可以长期保存；可以隐式转换为 std::string_view，在任何接受键的位置使用。
+ */
+class JsonKey {
+  public:
     /**
-     * @brief 获取字符串值的引用
-     * @return 字符串值的常量引用
-     * @exception JsonException 如果当前类型不是字符串，抛出异常
+     * @brief 构造键并计算哈希值。
+     * @param key 键（复制内容）
      */
-    inline const JsonString& asString() const {
-        if (m_type != JsonType::String) {
-            throw JsonException("not a string");
-        }
-        return *m_value.string;
+    explicit JsonKey(std::string_view key) : m_key(key), m_hash(hash(key)) {}
+
+    /**
+     * @brief 获取键的内容。
+     * @return 指向键内容的字符串视图。
+     */
+    std::string_view view() const noexcept {
+        return m_key.view();
     }
 
     /**
-     * @brief 获取数组值的引用
-     * @return 数组值的引用
-     * @exception JsonException 如果当前类型不是数组，抛出异常
+     * @brief 获取键的长度。
+     * @return 键的字节数。
      */
-    inline JsonArray& asArray() {
-        if (m_type != JsonType::Array) {
-            throw JsonException("not an array");
-        }
-        return *m_value.array;
+    size_t size() const noexcept {
+        return m_key.size();
     }
 
     /**
-     * @brief 获取数组值的引用
-     * @return 数组值的常量引用
-     * @exception JsonException 如果当前类型不是数组，抛出异常
+     * @brief 获取预先计算的哈希值。
+     * @return 哈希值，与 JsonKey::hash(view()) 相同。
      */
-    inline const JsonArray& asArray() const {
-        if (m_type != JsonType::Array) {
-            throw JsonException("not an array");
-        }
-        return *m_value.array;
+    uint32_t hash() const noexcept {
+        return m_hash;
     }
 
     /**
-     * @brief 获取对象值的引用
-     * @return 对象值的引用
-     * @exception JsonException 如果当前类型不是对象，抛出异常
+     * @brief 转换为字符串视图。
      */
-    inline JsonObject& asObject() {
-        if (m_type != JsonType::Object) {
-            throw JsonException("not an object");
+    operator std::string_view() const noexcept {
+        return m_key.view();
+    }
+
+    /**
+     * @brief 计算键的哈希值（每次混合 8 个字节，尾部用定长的重叠读取），与 JsonObject 的哈希索引一致。
+     *
+     * 哈希以进程启动后随机选取的种子开始，攻击者无法预先构造大量哈希冲突的键，
+     * 因此哈希值只在同一进程内有效，不能保存或在进程之间传递。
+     * @param key 键。
+     * @return 哈希值。
+     */
+    static uint32_t hash(std::string_view key) noexcept {
+        const char* data   = key.data();
+        const char* last   = data + key.size();
+        uint64_t    result = seed() ^ key.size();
+        auto        mix    = [&result](uint64_t word) {
+            result = (result ^ word) * 0xff51afd7ed558ccdULL;
+            result ^= result >> 32;
+        };
+        if (key.size() > 8) {
+            for (; last - data > 8; data += 8) {
+                mix(load<uint64_t>(data));
+            }
+            mix(load<uint64_t>(last - 8));
+        } else if (key.size() >= 4) {
+            mix(static_cast<uint64_t>(load<uint32_t>(data)) << 32 | load<uint32_t>(last - 4));
+        } else if (!key.empty()) {
+            mix(static_cast<uint64_t>(static_cast<uint8_t>(data[0])) << 16 |
+                static_cast<uint64_t>(static_cast<uint8_t>(data[key.size() / 2])) << 8 |
+                static_cast<uint8_t>(last[-1]));
         }
-        return *m_value.object;
+        return static_cast<uint32_t>(result);
     }
 
+  private:
     /**
-     * @brief 获取对象值的引用
-     * @return 对象值的常量引用
-     * @exception JsonException 如果当前类型不是对象，抛出异常
+     * @brief 获取本进程的哈希种子（第一次调用时选取）
      */
-    inline const JsonObject& asObject() const {
-        if (m_type != JsonType::Object) {
-            throw JsonException("not an object");
-        }
-        return *m_value.object;
+    static uint64_t seed() noexcept {
+        static const uint64_t value = randomSeed();
+        return value;
     }
 
     /**
-     * @brief 使用初始化列表为数组赋值
-     * @param init 初始化列表，包含 JsonValue 元素
-     * @return 自身引用
-     * @note 释放现有数据并构造新的 JSON 数组
+     * @brief 由随机设备、时钟和地址空间布局生成哈希种子。
      */
-    JsonValue& operator=(std::initializer_list<JsonValue> init) {
-        destroyValue();
-        m_type        = JsonType::Array;
-        m_value.array = new JsonArray(init);
-        return *this;
+    static uint64_t randomSeed() noexcept;
+
+    /**
+     * @brief 从未对齐的地址读取整数。
+     */
+    template <typename T>
+    static T load(const char* data) noexcept {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
     }
 
+    JsonObjectKey m_key;   ///< 键的副本
+    uint32_t      m_hash;  ///< 预先计算的哈希值
+};
+
+/**
+ * @class BasicJsonObject
+ * @brief JSON 对象的扁平存储：按插入顺序连续保存键值对。
+ *
+ * 成员不超过 INDEX_THRESHOLD 个时逐个比较键；超过后另外维护一个开放寻址（线性探测）的哈希索引，
+ * 查找只比较哈希值相同的键。哈希使用每个进程随机的种子，不可信输入中的键无法预先构造冲突；
+ * 删除成员时只移除对应的槽位，不重建索引。所有查找都直接接受字符串视图，不构造临时的键。
+ * 遍历顺序为插入顺序，解析得到的对象即为文档中的顺序；键重复时保留第一次插入的值。
+ *
+ * 接口与 std::map 相近，但与 std::vector 相同，插入或删除成员会使已有的迭代器和引用失效；
+ * 通过迭代器只能修改值，修改键会使查找失效。
+ * @tparam Value 值类型（JsonValue）。写成模板是为了在 JsonValue 定义完整之前声明对象类型。
+ */
+template <typename Value>
+class BasicJsonObject {
+  public:
+    using key_type        = JsonObjectKey;                                ///< 键类型
+    using mapped_type     = Value;                                        ///< 值类型
+    using value_type      = std::pair<JsonObjectKey, Value>;              ///< 成员类型
+    using size_type       = size_t;                                       ///< 大小类型
+    using difference_type = std::ptrdiff_t;                               ///< 迭代器差值类型
+    using allocator_type  = std::pmr::polymorphic_allocator<value_type>;  ///< 分配器类型
+    using reference       = value_type&;                                  ///< 成员引用
+    using const_reference = const value_type&;                            ///< 成员常量引用
+    using iterator        = typename std::pmr::vector<value_type>::iterator;  ///< 迭代器
+    using const_iterator =
+        typename std::pmr::vector<value_type>::const_iterator;  ///< 常量迭代器
+
+    /// 成员数超过该值后建立哈希索引
+    static constexpr size_t INDEX_THRESHOLD = 16;
+
+    /// 限定键参数为可以转换为 std::string_view 的类型（包括 JsonObjectKey 与 JsonKey）
+    template <typename K>
+    using EnableIfKey = std::enable_if_t<IsObjectKey<K>::value>;
+
     /**
-     * @brief 使用初始化列表为对象赋值（键值对）
-     * @tparam T 初始化列表元素类型（需可转换为 std::pair&lt;const char*, JsonValue&gt;）
-     * @param init 初始化列表，包含键值对。
-     * @return 自身引用。
+     * @brief 构造空对象，从默认的内存资源分配。
      */
-    template <
-        typename T,
-        std::enable_if_t<std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
-    JsonValue& operator=(std::initializer_list<T> init) {
-        // 释放之前的数据
-        destroyValue();
-        // 对象赋值
-        m_type         = JsonType::Object;
-        m_value.object = new JsonObject();
-        for (const auto& [k, v] : init) {
-            (*m_value.object)[k] = v;
+    BasicJsonObject() = default;
+
+    /**
+     * @brief 构造空对象，成员与索引从 allocator 的内存资源分配。
+     * @param allocator 分配器（可以由 std::pmr::memory_resource* 隐式构造）
+     */
+    explicit BasicJsonObject(const allocator_type& allocator) noexcept
+        : m_entries(allocator), m_index(allocator) {}
+
+    /**
+     * @brief 由初始化列表构造对象，键重复时保留第一次出现的值。
+     * @param init 键值对列表。
+     * @param allocator 分配器。
+     */
+    BasicJsonObject(std::initializer_list<value_type> init, const allocator_type& allocator = {})
+        : BasicJsonObject(allocator) {
+        m_entries.reserve(init.size());
+        for (const auto& entry : init) {
+            try_emplace(entry.first, entry.second);
         }
-        return *this;
     }
 
     /**
-     * @brief 使用初始化列表为数组赋值（非键值对）
-     * @tparam T 初始化列表元素类型（非需不可转换为 std::pair&lt;const char*, JsonValue&gt;）
-     * @param init 初始化列表，包含数组元素。
-     * @return 自身引用。
+     * @brief 获取分配器。
+     * @return 成员使用的分配器。
      */
-    template <
-        typename T,
-        std::enable_if_t<!std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
-    JsonValue& operator=(std::initializer_list<T> init) {
-        // 释放之前的数据
-        destroyValue();
-        // 数组赋值
-        m_type        = JsonType::Array;
-        m_value.array = new JsonArray();
-        m_value.array->reserve(init.size());
-        for (const auto& item : init) {
-            m_value.array->emplace_back(JsonValue(item));
-        }
-        return *this;
+    allocator_type get_allocator() const noexcept {
+        return m_entries.get_allocator();
+    }
+
+    iterator begin() noexcept {
+        return m_entries.begin();
+    }
+
+    iterator end() noexcept {
+        return m_entries.end();
+    }
+
+    const_iterator begin() const noexcept {
+        return m_entries.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return m_entries.end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return m_entries.cbegin();
+    }
+
+    const_iterator cend() const noexcept {
+        return m_entries.cend();
     }
 
     /**
-     * @brief 为向量赋值（std::vector）
-     * @tparam T 向量元素的类型
-     * @param vec 向量对象
-     * @return 自身引用
-     * @note 内部调用 toJson 将向量序列化为 JSON 数组
+     * @brief 获取成员数。
+     * @return 成员数。
      */
-    template <typename T>
-    JsonValue& operator=(const std::vector<T>& vec) {
-        *this = toJson(vec);
-        return *this;
+    size_t size() const noexcept {
+        return m_entries.size();
     }
 
     /**
-     * @brief 为映射赋值（std::map）
-     * @tparam T 映射值的类型
-     * @param map 映射对象
-     * @return 自身引用
-     * @note 内部调用 toJson 将映射序列化为 JSON 对象
+     * @brief 对象是否没有成员。
+     * @return 没有成员时返回 true。
      */
-    template <typename T>
-    JsonValue& operator=(const std::map<std::string, T>& map) {
-        *this = toJson(map);
-        return *this;
+    bool empty() const noexcept {
+        return m_entries.empty();
     }
 
     /**
-     * @brief 为无序映射赋值（std::unordered_map）
-     * @tparam T 映射值的类型
-     * @param map 无序映射对象
-     * @return 自身引用
-     * @note 内部调用 toJson 将无序映射序列化为 JSON 对象
+     * @brief 预留成员的存储空间；成员数超过 INDEX_THRESHOLD 时同时按该大小建立哈希索引。
+     * @param capacity 成员数。
      */
-    template <typename T>
-    JsonValue& operator=(const std::unordered_map<std::string, T>& map) {
-        *this = toJson(map);
-        return *this;
+    void reserve(size_t capacity) {
+        m_entries.reserve(capacity);
+        if (capacity > INDEX_THRESHOLD && m_index.size() < indexCapacity(capacity)) {
+            rehash(indexCapacity(capacity));
+        }
     }
 
     /**
-     * @brief 构造自定义类型的 JSON 数据（支持 toJson）
-     * @tparam T 类型（需实现 toJson 函数）
-     * @param value 值
-     * @note 使用 SFINAE 确保 T 支持 toJson 函数
+     * @brief 删除所有成员。
      */
-    template <typename T, typename std::enable_if<HasToJson<T>::value, int>::type = 0>
-    JsonValue(const T& value) : m_type() {
-        *this = toJson(value);
+    void clear() noexcept {
+        m_entries.clear();
+        m_index.clear();
     }
 
     /**
-     * @brief 为自定义类型赋值（支持 toJson）
-     * @tparam T 类型（需实现 toJson 函数）
-     * @param value 值
-     * @return 自身引用
+     * @brief 查找键。
+     * @param key 键（任何可以转换为 std::string_view 的类型，不构造临时的键；
+     *            JsonKey 使用预先计算的哈希值）
+     * @return 指向成员的迭代器，不存在时返回 end()。
      */
-    template <typename T, typename std::enable_if<HasToJson<T>::value, int>::type = 0>
-    JsonValue& operator=(const T& value) {
-        *this = toJson(value);
-        return *this;
+    template <typename K, typename = EnableIfKey<K>>
+    iterator find(const K& key) noexcept {
+        const size_t index = indexOf(key);
+        return index == NPOS ? end() : begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    template <typename K, typename = EnableIfKey<K>>
+    const_iterator find(const K& key) const noexcept {
+        const size_t index = indexOf(key);
+        return index == NPOS ? end() : begin() + static_cast<std::ptrdiff_t>(index);
     }
 
     /**
-     * @brief 创建空对象。
-     * @return JsonValue 表示空对象的 JsonValue。
+     * @brief 统计键出现的次数。
+     * @param key 键。
+     * @return 键存在时返回 1，否则返回 0。
      */
-    static JsonValue Object() {
-        return JsonObject();
+    template <typename K, typename = EnableIfKey<K>>
+    size_t count(const K& key) const noexcept {
+        return indexOf(key) == NPOS ? 0 : 1;
     }
 
     /**
-     * @brief 创建空数组。
-     * @return 表示空数组的 JsonValue。
+     * @brief 是否包含键。
+     * @param key 键。
+     * @return 包含时返回 true。
      */
-    static JsonValue Array() {
-        return JsonArray();
+    template <typename K, typename = EnableIfKey<K>>
+    bool contains(const K& key) const noexcept {
+        return indexOf(key) != NPOS;
     }
 
     /**
-     * @brief 设置对象的键值对
-     * @param key 键（字符串）
-     * @param value 值（JsonValue）
-     * @return 自身引用
-     * @note 如果当前对象不是 JSON 对象，会自动转换为对象类型
+     * @brief 访问键对应的值。
+     * @param key 键。
+     * @return 值的引用。
+     * @exception std::out_of_range 键不存在时抛出异常。
      */
-    JsonValue& set(const std::string& key, const JsonValue& value);
+    template <typename K, typename = EnableIfKey<K>>
+    Value& at(const K& key) {
+        const size_t index = indexOf(key);
+        if (index == NPOS) {
+            throw std::out_of_range("Key not found");
+        }
+        return m_entries[index].second;
+    }
+
+    template <typename K, typename = EnableIfKey<K>>
+    const Value& at(const K& key) const {
+        const size_t index = indexOf(key);
+        if (index == NPOS) {
+            throw std::out_of_range("Key not found");
+        }
+        return m_entries[index].second;
+    }
 
     /**
-     * @brief 向数组添加元素
-     * @param value 要添加的 JsonValue
-     * @return 自身引用
-     * @note 如果当前对象不是 JSON 数组，会自动转换为数组类型
+     * @brief 访问键对应的值，键不存在时插入空值。
+     * @param key 键（字符串、字符串视图、JsonObjectKey 或 JsonKey）
+     * @return 值的引用。
      */
-    JsonValue& push_back(JsonValue value);
+    template <typename K, typename = EnableIfKey<K>>
+    Value& operator[](K&& key) {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
 
     /**
-     * @brief 转换为布尔值。
-     * @exception JsonException 如果不是布尔类型，则抛出异常。
-     * @return 布尔值。
+     * @brief 键不存在时插入由 args 构造的值，已存在时不做任何事。
+     * @param key 键，只在插入时才用来构造 JsonObjectKey（右值的 JsonObjectKey 会被移动）
+     * @param args 值的构造参数。
+     * @return 指向成员的迭代器，以及是否插入。
      */
-    operator bool() const;
+    template <typename K, typename... Args, typename = EnableIfKey<K>>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+        const size_t index = indexOf(key);
+        if (index != NPOS) {
+            return {begin() + static_cast<std::ptrdiff_t>(index), false};
+        }
+        return {append(std::piecewise_construct,
+                       std::forward_as_tuple(JsonObjectKey(std::forward<K>(key))),
+                       std::forward_as_tuple(std::forward<Args>(args)...)),
+                true};
+    }
 
     /**
-     * @brief 转换为 16 位整数。
-     * @exception JsonException 如果不是数值类型，则抛出异常。
-     * @return 16 位整数值。
+     * @brief 插入或替换键对应的值。
+     * @param key 键。
+     * @param value 值。
+     * @return 指向成员的迭代器，以及是否插入（替换时为 false）
      */
-    operator int16_t() const;
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& value) {
+        auto result = try_emplace(std::forward<K>(key), std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
 
     /**
-     * @brief 转换为 32 位整数。
-     * @exception JsonException 如果不是数值类型，则抛出异常。
-     * @return 32 位整数值。
+     * @brief 键不存在时插入成员。
+     * @param entry 成员。
+     * @return 指向成员的迭代器，以及是否插入。
      */
-    operator int32_t() const;
+    std::pair<iterator, bool> insert(value_type&& entry) {
+        return try_emplace(std::move(entry.first), std::move(entry.second));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& entry) {
+        return try_emplace(entry.first, entry.second);
+    }
 
     /**
-     * @brief 转换为 64 位整数。
-     * @exception JsonException 如果不是数值类型，则抛出异常。
-     * @return 64 位整数值。
+     * @brief 由 args 构造成员，键不存在时插入。
+     * @param args 成员（std::pair<JsonObjectKey, Value>）的构造参数。
+     * @return 指向成员的迭代器，以及是否插入。
      */
-    operator int64_t() const;
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
 
     /**
-     * @brief 转换为浮点数（float）
-     * @exception JsonException 如果不是数值类型，则抛出异常。
-     * @return 浮点数值（float）
+     * @brief 删除成员，其后的成员保持原有顺序。
+     *
+     * 只从哈希索引中移除该成员的槽位并调整其后成员的下标，不重新计算其他键的哈希值。
+     * @param position 指向成员的迭代器。
+     * @return 指向下一个成员的迭代器。
      */
-    operator float() const;
+    iterator erase(const_iterator position) {
+        if (!m_index.empty()) {
+            unlinkSlot(static_cast<size_t>(position - cbegin()));
+        }
+        auto it = m_entries.erase(position);
+        if (m_entries.size() <= INDEX_THRESHOLD) {
+            m_index.clear();
+        }
+        return it;
+    }
 
     /**
-     * @brief 转换为浮点数（double）
-     * @exception JsonException 如果不是数值类型，则抛出异常。
-     * @return 浮点数值（double）
+     * @brief 删除一段成员，其后的成员保持原有顺序。
+     * @param first 第一个要删除的成员。
+     * @param last 最后一个要删除的成员之后的位置。
+     * @return 指向下一个成员的迭代器。
      */
-    operator double() const;
+    iterator erase(const_iterator first, const_iterator last) {
+        if (std::next(first) == last) {
+            return erase(first);
+        }
+        auto it = m_entries.erase(first, last);
+        reindex();
+        return it;
+    }
 
     /**
-     * @brief 转换为字符串。
-     * @exception JsonException 如果不是字符串类型，则抛出异常。
-     * @return 字符串值。
+     * @brief 删除键对应的成员。
+     * @param key 键。
+     * @return 删除的成员数（0 或 1）
      */
-    operator std::string() const;
+    size_t erase(std::string_view key) {
+        const auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    /**
+     * @brief 交换两个对象的内容。
+     */
+    void swap(BasicJsonObject& other) noexcept {
+        m_entries.swap(other.m_entries);
+        m_index.swap(other.m_index);
+    }
+
+  private:
+    static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+    /**
+     * @brief 哈希索引的槽位。
+     */
+    struct Slot {
+        uint32_t hash  = 0;  ///< 键的哈希值
+        uint32_t entry = 0;  ///< 成员下标加一，0 表示空槽位
+    };
+
+    /**
+     * @brief 查找键所在的下标。
+     * @param key 键。
+     * @return 成员下标，不存在时返回 NPOS。
+     */
+    size_t indexOf(std::string_view key) const noexcept {
+        return m_index.empty() ? scan(key) : probe(key, JsonKey::hash(key));
+    }
+
+    /**
+     * @brief 查找键所在的下标，使用预先计算的哈希值。
+     * @param key 键。
+     * @return 成员下标，不存在时返回 NPOS。
+     */
+    size_t indexOf(const JsonKey& key) const noexcept {
+        return m_index.empty() ? scan(key.view()) : probe(key.view(), key.hash());
+    }
+
+    /**
+     * @brief 逐个比较键（没有哈希索引时）
+     * @param key 键。
+     * @return 成员下标，不存在时返回 NPOS。
+     */
+    size_t scan(std::string_view key) const noexcept {
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if (m_entries[i].first.view() == key) {
+                return i;
+            }
+        }
+        return NPOS;
+    }
+
+    /**
+     * @brief 在哈希索引中查找键。
+     * @param key 键。
+     * @param code 键的哈希值。
+     * @return 成员下标，不存在时返回 NPOS。
+     */
+    size_t probe(std::string_view key, uint32_t code) const noexcept {
+        const size_t mask = m_index.size() - 1;
+        for (size_t slot = code & mask;; slot = (slot + 1) & mask) {
+            const Slot& candidate = m_index[slot];
+            if (candidate.entry == 0) {
+                return NPOS;
+            }
+            if (candidate.hash == code && m_entries[candidate.entry - 1].first.view() == key) {
+                return candidate.entry - 1;
+            }
+        }
+    }
+
+    /**
+     * @brief 在末尾追加成员（调用者保证键不存在），必要时建立或扩大索引。
+     * @param args 成员的构造参数。
+     * @return 指向新成员的迭代器。
+     */
+    template <typename... Args>
+    iterator append(Args&&... args) {
+        m_entries.emplace_back(std::forward<Args>(args)...);
+        const size_t index = m_entries.size() - 1;
+        if (m_index.empty() ? m_entries.size() > INDEX_THRESHOLD
+                            : m_entries.size() * 4 > m_index.size() * 3) {
+            try {
+                rehash(indexCapacity(m_entries.size()));
+            } catch (...) {
+                m_entries.pop_back();
+                throw;
+            }
+        } else if (!m_index.empty()) {
+            insertSlot(index);
+        }
+        return begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    /**
+     * @brief 计算容纳 count 个成员的索引大小，装载因子不超过 3/4（槽位中保存了哈希值，
+     *        线性探测经过的槽位大多不需要比较键）
+     * @param count 成员数。
+     * @return 索引的槽位数（2 的幂）
+     */
+    static size_t indexCapacity(size_t count) noexcept {
+        size_t capacity = INDEX_THRESHOLD;
+        while (capacity * 3 < count * 4) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    /**
+     * @brief 以新的大小重建哈希索引。
+     * @param capacity 槽位数（2 的幂）
+     */
+    void rehash(size_t capacity) {
+        m_index.assign(capacity, Slot{});
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            insertSlot(i);
+        }
+    }
+
+    /**
+     * @brief 把成员加入哈希索引。
+     * @param index 成员下标。
+     */
+    void insertSlot(size_t index) noexcept {
+        const uint32_t code = JsonKey::hash(m_entries[index].first.view());
+        const size_t   mask = m_index.size() - 1;
+        size_t         slot = code & mask;
+        while (m_index[slot].entry != 0) {
+            slot = (slot + 1) & mask;
+        }
+        m_index[slot] = Slot{code, static_cast<uint32_t>(index + 1)};
+    }
+
+    /**
+     * @brief 从哈希索引中移除一个成员（线性探测的后移删除，不留墓碑），并把其后成员的下标减一。
+     * @param index 要删除的成员的下标。
+     */
+    void unlinkSlot(size_t index) noexcept {
+        const size_t mask = m_index.size() - 1;
+        const auto   code = JsonKey::hash(m_entries[index].first.view());
+        size_t       hole = code & mask;
+        while (m_index[hole].entry != index + 1) {
+            hole = (hole + 1) & mask;
+        }
+        // 之后同一簇中的槽位，理想位置不在 (hole, next] 之间的可以前移填补空位
+        for (size_t next = (hole + 1) & mask; m_index[next].entry != 0; next = (next + 1) & mask) {
+            const size_t home = m_index[next].hash & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                m_index[hole] = m_index[next];
+                hole          = next;
+            }
+        }
+        m_index[hole] = Slot{};
+        for (auto& slot : m_index) {
+            if (slot.entry > index + 1) {
+                slot.entry--;
+            }
+        }
+    }
+
+    /**
+     * @brief 成员下标变化后在原有容量内重建索引；成员不超过阈值时删除索引。
+     */
+    void reindex() noexcept {
+        if (m_entries.size() <= INDEX_THRESHOLD) {
+            m_index.clear();
+            return;
+        }
+        for (auto& slot : m_index) {
+            slot = Slot{};
+        }
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            insertSlot(i);
+        }
+    }
+
+    std::pmr::vector<value_type> m_entries;  ///< 按插入顺序保存的成员
+    std::pmr::vector<Slot>       m_index;    ///< 哈希索引，为空时逐个比较键
+};
+
+/**
+ * @brief JSON 对象类型别名。
+ *
+ * 使用 BasicJsonObject<JsonValue> 作为 JSON 对象的存储类型：成员连续存储，查找直接接受字符串视图。
+ * 内存资源的规则与 JsonArray 相同。
+ */
+using JsonObject = BasicJsonObject<JsonValue>;
+
+// 容器序列化支持
+
+/**
+ * @brief JSON 对象反序列化为 std::vector
+ * @tparam T 向量元素的类型
+ * @param root 要反序列化的 JSON 对象
+ * @param vec 反序列化后的 std::vector 对象
+ * @note 如果 T 支持 fromJson函数，则使用 fromJson 进行反序列化；否则直接构造 JsonValue
+ */
+template <typename T>
+void fromJson(const JsonValue& root, std::vector<T>& vec);
+
+/**
+ * @brief 将 JSON 对象反序列化为键为字符串的映射
+ * @tparam Map 映射类型（std::map 或 std::unordered_map）
+ * @tparam T 映射值的类型
+ * @tparam S SFINAE 约束，确保键类型为 std::string 且 Map 为 std::map 或 std::unordered_map
+ * @param root 要反序列化的 JSON 对象
+ * @param map 反序列化后的映射对象
+ * @note 如果值类型支持 fromJson 函数，则使用 fromJson 反序列化；否则直接构造 JsonValue
+ */
+template <typename Map,
+          typename T = typename Map::mapped_type,
+          typename S = std::enable_if_t<std::is_same_v<typename Map::key_type, std::string> &&
+                                        (std::is_same_v<Map, std::map<std::string, T>> ||
+                                         std::is_same_v<Map, std::unordered_map<std::string, T>>)>>
+void fromJson(const JsonValue& root, Map& map);
+
+/**
+ * @brief 将 std::vector 序列化为 JSON 对象
+ * @tparam T 向量元素的类型
+ * @param vec 要序列化的向量
+ * @return 表示 JSON 数组的 JsonValue 对象
+ * @note 如果元素类型支持 toJson 函数，则使用 toJson 序列化；否则直接构造 JsonValue
+ */
+template <typename T>
+JsonValue toJson(const std::vector<T>& vec);
+
+/**
+ * @brief 将键为字符串的映射序列化为 JSON 对象
+ * @tparam Map 映射类型（std::map 或 std::unordered_map）
+ * @tparam T 映射值的类型
+ * @tparam S SFINAE 约束，确保键类型为 std::string 且 Map 为 std::map 或 std::unordered_map
+ * @param map 要序列化的映射
+ * @return 表示 JSON 对象的 JsonValue 对象
+ * @note 如果值类型支持 toJson 函数，则使用 toJson 序列化；否则直接构造 JsonValue
+ */
+template <typename Map,
+          typename T = typename Map::mapped_type,
+          typename S = std::enable_if_t<std::is_same_v<typename Map::key_type, std::string> &&
+                                        (std::is_same_v<Map, std::map<std::string, T>> ||
+                                         std::is_same_v<Map, std::unordered_map<std::string, T>>)>>
+JsonValue toJson(const Map& map);
+
+/**
+ * @class JsonValue
+ * @brief 表示 JSON 数据的核心类，支持多种 JSON 数据类型。
+ *
+ * 该类封装了 JSON 的基本数据类型（空值、布尔值、整数、浮点数、字符串、数组、对象），
+ * 提供构造、赋值、类型检查和数据访问等功能。支持动态类型转换和容器序列化。
+ *
+ * @note 该类使用联合体存储不同类型的值，大小固定为 16 字节；不超过 INLINE_STRING_CAPACITY 字节的
+ *       字符串（以及延迟解析的数字文本）直接保存在值内部，不单独分配内存。
+ */
+class JsonValue {
+  public:
+    /**
+     * @brief 可以保存在值内部的字符串的最大长度（字节）
+     */
+    static constexpr size_t INLINE_STRING_CAPACITY = 14;
+
+    /**
+     * @brief 默认构造函数，初始化为空值（Null）
+     */
+    JsonValue() noexcept : m_type(JsonType::Null) {}
+
+    /**
+     * @brief 构造空值类型的 JSON 数据。
+     * @param value 空值（std::nullptr_t）
+     */
+    JsonValue(std::nullptr_t) noexcept : m_type(JsonType::Null) {}
+
+    /**
+     * @brief 构造布尔类型的 JSON 数据。
+     * @param value 布尔值（true 或 false）
+     */
+    JsonValue(bool value) noexcept : m_type(JsonType::Boolean) {
+        m_value.boolean = value;
+    }
+
+    /**
+     * @brief 构造整数类型的 JSON 数据。
+     * @tparam T 整数类型（例如 int32_t、int64_t 等，非 bool）
+     * @param value 整数值。
+     */
+    template <typename T,
+              std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    JsonValue(T value) noexcept : m_type(JsonType::Integer) {
+        m_value.iNumber = static_cast<int64_t>(value);
+    }
+
+    /**
+     * @brief 构造浮点数类型的 JSON 数据。
+     * @tparam T 浮点数类型（例如 float、double）
+     * @param value 浮点数值。
+     */
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    JsonValue(T value) noexcept : m_type(JsonType::Double) {
+        m_value.dNumber = static_cast<double>(value);
+    }
+
+    /**
+     * @brief 构造字符串类型的 JSON 数据 (高级 SFINAE 版本)
+     * @param value 任何类似字符串的类型
+     */
+    template <typename T,
+              // SFINAE 约束条件
+              typename = std::enable_if_t<
+                  // 1. 类型 T 可以转换为 std::string_view
+                  std::is_convertible_v<const std::decay_t<T>&, std::string_view> &&
+                  // 2. 并且，类型 T 不是 JsonValue
+                  !std::is_same_v<std::decay_t<T>, JsonValue>>>
+    JsonValue(T&& value) noexcept : m_type(JsonType::String) {
+        setString(std::string_view(value));
+    }
+
+    /**
+     * @brief 构造字符串类型的 JSON 数据（短字符串保存在值内部，长字符串接管 value 的存储）
+     * @param value 字符串。
+     */
+    JsonValue(JsonString&& value) noexcept : m_type(JsonType::String) {
+        if (value.size() <= INLINE_STRING_CAPACITY) {
+            setString(value);
+        } else {
+            m_value.string = new JsonString(std::move(value));
+        }
+    }
+
+    /**
+     * @brief 创建引用外部内存的字符串，不复制内容。
+     *
+     * 拷贝得到的 JsonValue 会复制字符串内容；移动得到的 JsonValue 仍然引用同一块内存。
+     * 超过 UINT32_MAX 字节的字符串会被复制。
+     * @param value 字符串，其引用的内存必须在该值（及其移动得到的值）的整个生命周期内有效。
+     * @return 引用 value 的字符串 JsonValue。
+     */
+    static JsonValue borrow(std::string_view value) {
+        if (value.size() > UINT32_MAX) {
+            return JsonString(value);
+        }
+        JsonValue result;
+        result.m_type       = JsonType::String;
+        result.m_storage    = Storage::Borrowed;
+        result.m_length     = static_cast<uint32_t>(value.size());
+        result.m_value.view = value.data();
+        return result;
+    }
+
+    /**
+     * @brief 构造数组类型的 JSON 数据。
+     * @param value JSON 数组对象。
+     */
+    JsonValue(const JsonArray& value) noexcept : m_type(JsonType::Array) {
+        m_value.array = new JsonArray(value);
+    }
+
+    /**
+     * @brief 构造对象类型的 JSON 数据。
+     * @param value JSON 对象（键值对映射）
+     */
+    JsonValue(const JsonObject& value) noexcept : m_type(JsonType::Object) {
+        m_value.object = new JsonObject(value);
+    }
+
+    /**
+     * @brief 构造数组类型的 JSON 数据（移动已有数组，不复制元素）
+     * @param value JSON 数组对象。
+     */
+    JsonValue(JsonArray&& value) noexcept : m_type(JsonType::Array) {
+        m_value.array = new JsonArray(std::move(value));
+    }
+
+    /**
+     * @brief 构造对象类型的 JSON 数据（移动已有对象，不复制键值对）
+     * @param value JSON 对象（键值对映射）
+     */
+    JsonValue(JsonObject&& value) noexcept : m_type(JsonType::Object) {
+        m_value.object = new JsonObject(std::move(value));
+    }
+
+    /**
+     * @brief 构造数组类型的 JSON 数据（std::vector）
+     * @tparam T 向量元素的类型。
+     * @param vec 向量对象。
+     */
+    template <typename T>
+    JsonValue(const std::vector<T>& vec) : m_type(JsonType::Array) {
+        *this = toJson(vec);
+    }
+
+    /**
+     * @brief 构造对象类型的 JSON 数据（std::map）
+     * @tparam T 映射值的类型。
+     * @param map 映射对象。
+     */
+    template <typename T>
+    JsonValue(const std::map<std::string, T>& map) : m_type(JsonType::Object) {
+        *this = toJson(map);
+    }
+
+    /**
+     * @brief 构造对象类型的 JSON 数据（std::unordered_map）
+     * @tparam T 映射值的类型。
+     * @param map 无序映射对象。
+     */
+    template <typename T>
+    JsonValue(const std::unordered_map<std::string, T>& map) : m_type(JsonType::Object) {
+        *this = toJson(map);
+    }
+
+    /**
+     * @brief 使用初始化列表构造对象类型的 JSON 数据。
+     * @tparam T 值类型。
+     * @param init 初始化列表，包含键值对（const char*, T）
+     */
+    template <typename T>
+    JsonValue(std::initializer_list<std::pair<const char*, T>> init) : m_type(JsonType::Object) {
+        m_value.object = new JsonObject();
+        for (const auto& [k, v] : init) {
+            (*m_value.object)[k] = JsonValue(v);
+        }
+    }
+
+    /**
+     * @brief 使用初始化列表构造对象类型的 JSON 数据（JsonValue 值）
+     * @param init 初始化列表，包含键值对（const char*, JsonValue）
+     */
+    JsonValue(std::initializer_list<std::pair<const char*, JsonValue>> init)
+        : m_type(JsonType::Object) {
+        m_value.object = new JsonObject();
+        for (const auto& [k, v] : init) {
+            (*m_value.object)[k] = v;
+        }
+    }
+
+    /**
+     * @brief 使用初始化列表构造对象类型的 JSON 数据（通用类型，转换为键值对）
+     * @tparam T 初始化列表元素类型（需可转换为 std::pair&lt;const char*, JsonValue&gt;）
+     * @param init 初始化列表。
+     */
+    template <
+        typename T,
+        std::enable_if_t<std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
+    JsonValue(std::initializer_list<T> init) {
+        // 对象初始化
+        m_type         = JsonType::Object;
+        m_value.object = new JsonObject();
+        for (const auto& item : init) {
+            auto pair                     = static_cast<std::pair<const char*, JsonValue>>(item);
+            (*m_value.object)[pair.first] = pair.second;
+        }
+    }
+
+    /**
+     * @brief 使用初始化列表构造数组类型的 JSON 数据。
+     * @param init 初始化列表，包含非键值对的元素。
+     */
+    template <
+        typename T,
+        std::enable_if_t<!std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
+    JsonValue(std::initializer_list<T> init) {
+        // 数组初始化
+        m_type        = JsonType::Array;
+        m_value.array = new JsonArray();
+        m_value.array->reserve(init.size());
+        for (const auto& item : init) {
+            m_value.array->emplace_back(JsonValue(item));
+        }
+    }
+
+    /**
+     * @brief 拷贝构造函数。
+     */
+    JsonValue(const JsonValue& other);
+
+    /**
+     * @brief 移动构造函数。
+     * @param other JsonValue 对象（右值）
+     */
+    JsonValue(JsonValue&& other) noexcept;
+
+    /**
+     * @brief 拷贝赋值运算符。
+     * @param other 要赋值的 JsonValue 对象。
+     * @return 自身引用。
+     */
+    JsonValue& operator=(const JsonValue& other);
+
+    /**
+     * @brief 移动赋值运算符。
+     * @param other JsonValue 对象（右值）
+     * @return 自身引用。
+     */
+    JsonValue& operator=(JsonValue&& other) noexcept;
+
+    /**
+     * @brief 析构函数，释放内部资源。
+     */
+    ~JsonValue();
+
+    /**
+     * @brief 获取 JSON 数据类型。
+     * @return 当前 JSON 值的类型（JsonType）
+     */
+    inline JsonType type() const noexcept {
+        return m_type;
+    }
+
+    /**
+     * @brief 检查是否为空值（Null）
+     * @return 如果是空值，返回 true，否则返回 false。
+     */
+    inline bool isNull() const noexcept {
+        return m_type == JsonType::Null;
+    }
+
+    /**
+     * @brief 检查是否为布尔类型。
+     * @return 如果是布尔值，返回 true，否则返回 false。
+     */
+    inline bool isBoolean() const noexcept {
+        return m_type == JsonType::Boolean;
+    }
+
+    /**
+     * @brief 检查是否为数值类型（整数或浮点数）
+     * @return 如果是数值类型，返回 true，否则返回 false。
+     */
+    inline bool isNumber() const noexcept {
+        return m_type == JsonType::Integer || m_type == JsonType::Double;
+    }
+
+    /**
+     * @brief 检查是否为字符串类型。
+     * @return 如果是字符串，返回 true，否则返回 false。
+     */
+    inline bool isString() const noexcept {
+        return m_type == JsonType::String;
+    }
+
+    /**
+     * @brief 检查是否为数组类型。
+     * @return 如果是数组，返回 true，否则返回 false。
+     */
+    inline bool isArray() const noexcept {
+        return m_type == JsonType::Array;
+    }
+
+    /**
+     * @brief 检查是否为对象类型
+     * @return 如果是对象，返回 true，否则，返回 false
+     */
+    inline bool isObject() const noexcept {
+        return m_type == JsonType::Object;
+    }
+
+    /**
+     * @brief 获取字符串值的引用
+     * @return 字符串值的引用
+     * @exception JsonException 如果当前类型不是字符串，抛出异常
+     * @note 保存在值内部或引用外部内存的字符串会转换为堆上的 JsonString，以便通过引用修改；
+     *       只读访问请使用不分配内存的 asStringView()
+     */
+    inline JsonString& asString() {
+        if (m_type != JsonType::String) {
+            throw JsonException("not a string");
+        }
+        return m_storage == Storage::Heap ? *m_value.string : ownString();
+    }
+
+    /**
+     * @brief 获取字符串值的引用
+     * @return 字符串值的常量引用
+     * @exception JsonException 如果当前类型不是字符串，抛出异常
+     * @note 保存在值内部或引用外部内存的字符串在第一次调用时转换为堆上的 JsonString（内容不变），
+     *       之后的调用直接返回它；该转换会写入值的内部存储，多个线程同时读取同一个值时
+     *       请使用不分配也不修改值的 asStringView()
+     */
+    inline const JsonString& asString() const {
+        if (m_type != JsonType::String) {
+            throw JsonException("not a string");
+        }
+        return m_storage == Storage::Heap ? *m_value.string : ownString();
+    }
+
+    /**
+     * @brief 获取字符串值的视图，不复制也不分配内存
+     * @return 指向字符串内容的视图（在值被修改或销毁前有效）
+     * @exception JsonException 如果当前类型不是字符串，抛出异常
+     */
+    inline std::string_view asStringView() const {
+        if (m_type != JsonType::String) {
+            throw JsonException("not a string");
+        }
+        if (m_storage == Storage::Borrowed) {
+            return {m_value.view, m_length};
+        }
+        if (isInlineString()) {
+            return {inlineString(), inlineStringLength()};
+        }
+        return *m_value.string;
+    }
+
+    /**
+     * @brief 字符串或数字的原始文本是否引用外部内存（由 parser::parseDocument 解析得到）
+     * @return 引用外部内存时返回 true。
+     */
+    inline bool isBorrowed() const noexcept {
+        return m_storage == Storage::Borrowed;
+    }
+
+    /**
+     * @brief 获取数字的原始文本（以 ENABLE_LAZY_NUMBER 解析得到的数字）
+     * @return 数字在 JSON 中的原始文本；不是数字或没有保留原始文本时返回空视图
+     * @note parse 得到的超过 INLINE_STRING_CAPACITY 字节的整数直接保存转换结果（序列化结果与
+     *       原始文本相同），同样返回空视图。
+     */
+    inline std::string_view rawNumber() const noexcept {
+        if (!isNumber()) {
+            return {};
+        }
+        switch (m_storage) {
+            case Storage::Borrowed:
+            case Storage::HeapText: return {m_value.view, m_length};
+            case Storage::Heap: return {};
+            default: return {inlineString(), inlineStringLength()};
+        }
+    }
+
+    /**
+     * @brief 获取数组值的引用
+     * @return 数组值的引用
+     * @exception JsonException 如果当前类型不是数组，抛出异常
+     */
+    inline JsonArray& asArray() {
+        if (m_type != JsonType::Array) {
+            throw JsonException("not an array");
+        }
+        return *m_value.array;
+    }
+
+    /**
+     * @brief 获取数组值的引用
+     * @return 数组值的常量引用
+     * @exception JsonException 如果当前类型不是数组，抛出异常
+     */
+    inline const JsonArray& asArray() const {
+        if (m_type != JsonType::Array) {
+            throw JsonException("not an array");
+        }
+        return *m_value.array;
+    }
+
+    /**
+     * @brief 获取对象值的引用
+     * @return 对象值的引用
+     * @exception JsonException 如果当前类型不是对象，抛出异常
+     */
+    inline JsonObject& asObject() {
+        if (m_type != JsonType::Object) {
+            throw JsonException("not an object");
+        }
+        return *m_value.object;
+    }
+
+    /**
+     * @brief 获取对象值的引用
+     * @return 对象值的常量引用
+     * @exception JsonException 如果当前类型不是对象，抛出异常
+     */
+    inline const JsonObject& asObject() const {
+        if (m_type != JsonType::Object) {
+            throw JsonException("not an object");
+        }
+        return *m_value.object;
+    }
+
+    /**
+     * @brief 使用初始化列表为数组赋值
+     * @param init 初始化列表，包含 JsonValue 元素
+     * @return 自身引用
+     * @note 释放现有数据并构造新的 JSON 数组
+     */
+    JsonValue& operator=(std::initializer_list<JsonValue> init) {
+        destroyValue();
+        m_type        = JsonType::Array;
+        m_value.array = new JsonArray(init);
+        return *this;
+    }
+
+    /**
+     * @brief 使用初始化列表为对象赋值（键值对）
+     * @tparam T 初始化列表元素类型（需可转换为 std::pair&lt;const char*, JsonValue&gt;）
+     * @param init 初始化列表，包含键值对。
+     * @return 自身引用。
+     */
+    template <
+        typename T,
+        std::enable_if_t<std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
+    JsonValue& operator=(std::initializer_list<T> init) {
+        // 释放之前的数据
+        destroyValue();
+        // 对象赋值
+        m_type         = JsonType::Object;
+        m_value.object = new JsonObject();
+        for (const auto& [k, v] : init) {
+            (*m_value.object)[k] = v;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 使用初始化列表为数组赋值（非键值对）
+     * @tparam T 初始化列表元素类型（非需不可转换为 std::pair&lt;const char*, JsonValue&gt;）
+     * @param init 初始化列表，包含数组元素。
+     * @return 自身引用。
+     */
+    template <
+        typename T,
+        std::enable_if_t<!std::is_convertible_v<T, std::pair<const char*, JsonValue>>, int> = 0>
+    JsonValue& operator=(std::initializer_list<T> init) {
+        // 释放之前的数据
+        destroyValue();
+        // 数组赋值
+        m_type        = JsonType::Array;
+        m_value.array = new JsonArray();
+        m_value.array->reserve(init.size());
+        for (const auto& item : init) {
+            m_value.array->emplace_back(JsonValue(item));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 为向量赋值（std::vector）
+     * @tparam T 向量元素的类型
+     * @param vec 向量对象
+     * @return 自身引用
+     * @note 内部调用 toJson 将向量序列化为 JSON 数组
+     */
+    template <typename T>
+    JsonValue& operator=(const std::vector<T>& vec) {
+        *this = toJson(vec);
+        return *this;
+    }
+
+    /**
+     * @brief 为映射赋值（std::map）
+     * @tparam T 映射值的类型
+     * @param map 映射对象
+     * @return 自身引用
+     * @note 内部调用 toJson 将映射序列化为 JSON 对象
+     */
+    template <typename T>
+    JsonValue& operator=(const std::map<std::string, T>& map) {
+        *this = toJson(map);
+        return *this;
+    }
+
+    /**
+     * @brief 为无序映射赋值（std::unordered_map）
+     * @tparam T 映射值的类型
+     * @param map 无序映射对象
+     * @return 自身引用
+     * @note 内部调用 toJson 将无序映射序列化为 JSON 对象
+     */
+    template <typename T>
+    JsonValue& operator=(const std::unordered_map<std::string, T>& map) {
+        *this = toJson(map);
+        return *this;
+    }
+
+    /**
+     * @brief 构造自定义类型的 JSON 数据（支持 toJson）
+     * @tparam T 类型（需实现 toJson 函数）
+     * @param value 值
+     * @note 使用 SFINAE 确保 T 支持 toJson 函数
+     */
+    template <typename T, typename std::enable_if<HasToJson<T>::value, int>::type = 0>
+    JsonValue(const T& value) : m_type() {
+        *this = toJson(value);
+    }
+
+    /**
+     * @brief 为自定义类型赋值（支持 toJson）
+     * @tparam T 类型（需实现 toJson 函数）
+     * @param value 值
+     * @return 自身引用
+     */
+    template <typename T, typename std::enable_if<HasToJson<T>::value, int>::type = 0>
+    JsonValue& operator=(const T& value) {
+        *this = toJson(value);
+        return *this;
+    }
+
+    /**
+     * @brief 创建空对象。
+     * @return JsonValue 表示空对象的 JsonValue。
+     */
+    static JsonValue Object() {
+        return JsonObject();
+    }
+
+    /**
+     * @brief 创建空数组。
+     * @return 表示空数组的 JsonValue。
+     */
+    static JsonValue Array() {
+        return JsonArray();
+    }
+
+    /**
+     * @brief 设置对象的键值对
+     * @param key 键（字符串视图，键已存在时不复制）
+     * @param value 值（JsonValue）
+     * @return 自身引用
+     * @note 如果当前对象不是 JSON 对象，会自动转换为对象类型
+     */
+    JsonValue& set(std::string_view key, const JsonValue& value);
+
+    /**
+     * @brief 向数组添加元素
+     * @param value 要添加的 JsonValue
+     * @return 自身引用
+     * @note 如果当前对象不是 JSON 数组，会自动转换为数组类型
+     */
+    JsonValue& push_back(JsonValue value);
+
+    /**
+     * @brief 转换为布尔值。
+     * @exception JsonException 如果不是布尔类型，则抛出异常。
+     * @return 布尔值。
+     */
+    operator bool() const;
+
+    /**
+     * @brief 转换为 16 位整数。
+     * @exception JsonException 如果不是数值类型，则抛出异常。
+     * @return 16 位整数值。
+     */
+    operator int16_t() const;
+
+    /**
+     * @brief 转换为 32 位整数。
+     * @exception JsonException 如果不是数值类型，则抛出异常。
+     * @return 32 位整数值。
+     */
+    operator int32_t() const;
+
+    /**
+     * @brief 转换为 64 位整数。
+     * @exception JsonException 如果不是数值类型，则抛出异常。
+     * @return 64 位整数值。
+     */
+    operator int64_t() const;
+
+    /**
+     * @brief 转换为浮点数（float）
+     * @exception JsonException 如果不是数值类型，则抛出异常。
+     * @return 浮点数值（float）
+     */
+    operator float() const;
+
+    /**
+     * @brief 转换为浮点数（double）
+     * @exception JsonException 如果不是数值类型，则抛出异常。
+     * @return 浮点数值（double）
+     */
+    operator double() const;
+
+    /**
+     * @brief 转换为字符串。
+     * @exception JsonException 如果不是字符串类型，则抛出异常。
+     * @return 字符串值。
+     */
+    operator std::string() const;
 
     /**
      * @brief 获取指定类型的值。
@@ -729,565 +1824,1715 @@ class JsonValue {
      * @exception JsonException 或 std::runtime_error 如果类型不匹配或转换失败。
      * @note 支持基本类型、JsonObject、JsonArray 和自定义序列化类型（须实现fromJson函数）
      */
-    template <typename T>
-    T get() const {
-        if constexpr (std::is_same_v<T, JsonValue>) {
-            return *this;
-        } else if constexpr (std::is_arithmetic_v<T>) {
-            // 支持所有数值类型之间的转换
-            if (!(isNumber() || isBoolean())) {
-                throw JsonException("Cannot convert to numeric type");
-            }
-            if (m_type == JsonType::Integer) {
-                return static_cast<T>(m_value.iNumber);
-            } else if (m_type == JsonType::Boolean) {
-                return m_value.boolean;
-            } else {
-                return static_cast<T>(m_value.dNumber);
-            }
-        } else if constexpr (std::is_same_v<T, std::string> ||
-                             std::is_same_v<T, std::string_view>) {
-            return operator std::string();
-        } else if constexpr (HasFromJson<T>::value) {
-            // 处理自定义类型
-            T result;
-            fromJson(*this, result);
-            return result;
-        } else {
-            // 这行永远不会执行，只是为了避免编译器警告
-            static_assert(std::is_void_v<T>, "Unsupported type for get<T>()");
-            return T{};
-        }
-    }
+    template <typename T>
+    T get() const {
+        if constexpr (std::is_same_v<T, JsonValue>) {
+            return *this;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            // 支持所有数值类型之间的转换
+            if (!(isNumber() || isBoolean())) {
+                throw JsonException("Cannot convert to numeric type");
+            }
+            if (m_type == JsonType::Integer) {
+                return static_cast<T>(integerValue());
+            } else if (m_type == JsonType::Boolean) {
+                return m_value.boolean;
+            } else {
+                return static_cast<T>(doubleValue());
+            }
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return operator std::string();
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            if (!isString()) {
+                throw JsonException("Cannot convert to string");
+            }
+            return asStringView();
+        } else if constexpr (std::is_same_v<T, JsonObject>) {
+            return asObject();
+        } else if constexpr (std::is_same_v<T, JsonArray>) {
+            return asArray();
+        } else if constexpr (HasFromJson<T>::value) {
+            // 处理自定义类型
+            T result;
+            fromJson(*this, result);
+            return result;
+        } else {
+            // 这行永远不会执行，只是为了避免编译器警告
+            static_assert(std::is_void_v<T>, "Unsupported type for get<T>()");
+            return T{};
+        }
+    }
+
+    /**
+     * @brief 获取指定类型的值，类型不匹配时不抛出异常。
+     * @param T 目标类型，转换规则与 get<T>() 相同。
+     * @return 指定类型 T 的值；类型不匹配或转换失败时返回 std::nullopt。
+     * @note 自定义类型的 fromJson 抛出的 JsonException 同样转换为 std::nullopt。
+     */
+    template <typename T>
+    std::optional<T> try_get() const {
+        if constexpr (std::is_same_v<T, JsonValue>) {
+            return *this;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            if (m_type == JsonType::Integer) {
+                return static_cast<T>(integerValue());
+            } else if (m_type == JsonType::Double) {
+                return static_cast<T>(doubleValue());
+            } else if (m_type == JsonType::Boolean) {
+                return static_cast<T>(m_value.boolean);
+            }
+            return std::nullopt;
+        } else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>) {
+            return isString() ? std::optional<T>(asStringView()) : std::nullopt;
+        } else if constexpr (std::is_same_v<T, JsonObject>) {
+            return isObject() ? std::optional<T>(*m_value.object) : std::nullopt;
+        } else if constexpr (std::is_same_v<T, JsonArray>) {
+            return isArray() ? std::optional<T>(*m_value.array) : std::nullopt;
+        } else if constexpr (HasFromJson<T>::value) {
+            try {
+                T result;
+                fromJson(*this, result);
+                return result;
+            } catch (const JsonException&) {
+                return std::nullopt;
+            }
+        } else {
+            static_assert(std::is_void_v<T>, "Unsupported type for try_get<T>()");
+            return std::nullopt;
+        }
+    }
+
+    /**
+     * @brief 获取指向值的指针，类型不匹配时返回空指针而不抛出异常。
+     * @param T bool、JsonString、JsonArray 或 JsonObject（数字请使用 try_get<T>()）
+     * @return 指向值的指针，在值被修改或销毁前有效；类型不匹配时返回 nullptr。
+     * @note 与 asString() 相同，get_if<JsonString>() 会把保存在值内部或引用外部内存的字符串
+     *       转换为堆上的 JsonString；只读访问请使用不修改值的 try_get<std::string_view>()
+     */
+    template <typename T>
+    const T* get_if() const {
+        if constexpr (std::is_same_v<T, bool>) {
+            return isBoolean() ? &m_value.boolean : nullptr;
+        } else if constexpr (std::is_same_v<T, JsonString>) {
+            return isString() ? &asString() : nullptr;
+        } else if constexpr (std::is_same_v<T, JsonArray>) {
+            return isArray() ? m_value.array : nullptr;
+        } else if constexpr (std::is_same_v<T, JsonObject>) {
+            return isObject() ? m_value.object : nullptr;
+        } else {
+            static_assert(std::is_void_v<T>, "Unsupported type for get_if<T>()");
+            return nullptr;
+        }
+    }
+
+    template <typename T>
+    T* get_if() {
+        return const_cast<T*>(static_cast<const JsonValue&>(*this).get_if<T>());
+    }
+
+    /**
+     * @brief 查找对象的成员，只查找一次且不抛出异常。
+     * @param key 键（任何可以转换为 std::string_view 的类型，JsonKey 使用预先计算的哈希值）
+     * @return 指向成员值的指针；不是对象或键不存在时返回 nullptr。
+     */
+    template <typename T, std::enable_if_t<IsObjectKey<T>::value, int> = 0>
+    const JsonValue* find(const T& key) const noexcept {
+        if (!isObject()) {
+            return nullptr;
+        }
+        auto it = m_value.object->find(key);
+        return it != m_value.object->end() ? &it->second : nullptr;
+    }
+
+    template <typename T, std::enable_if_t<IsObjectKey<T>::value, int> = 0>
+    JsonValue* find(const T& key) noexcept {
+        return const_cast<JsonValue*>(static_cast<const JsonValue&>(*this).find(key));
+    }
+
+    /**
+     * @brief 访问数组元素，不抛出异常。
+     * @param index 下标。
+     * @return 指向元素的指针；不是数组或下标越界时返回 nullptr。
+     */
+    const JsonValue* at(size_t index) const noexcept {
+        if (!isArray() || index >= m_value.array->size()) {
+            return nullptr;
+        }
+        return m_value.array->data() + index;
+    }
+
+    JsonValue* at(size_t index) noexcept {
+        return const_cast<JsonValue*>(static_cast<const JsonValue&>(*this).at(index));
+    }
+
+    /**
+     * @brief 读取对象中可选的成员，只查找一次且不抛出异常。
+     * @param key 键。
+     * @param defaultValue 不是对象、键不存在或成员类型不匹配时返回的默认值。
+     * @return 成员按 try_get 转换后的值，或 defaultValue（字符串字面量的默认值得到 std::string）
+     */
+    template <typename K, typename T, std::enable_if_t<IsObjectKey<K>::value, int> = 0>
+    auto value_or(const K& key, T&& defaultValue) const {
+        using Result = std::conditional_t<std::is_convertible_v<std::decay_t<T>, const char*>,
+                                          std::string,
+                                          std::decay_t<T>>;
+        if (const JsonValue* member = find(key)) {
+            if (auto value = member->try_get<Result>()) {
+                return std::move(*value);
+            }
+        }
+        return Result(std::forward<T>(defaultValue));
+    }
+
+    /**
+     * @brief 访问数组元素（可读写）
+     * @param T 数组索引（整数）
+     * @param key 参数类型（整数）
+     * @return 数组中对应索引的 JsonValue 引用。
+     * @exception std::out_of_range 如果索引为负数。
+     */
+    template <typename T, std::enable_if_t<std::is_integral_v<std::remove_reference_t<T>>, int> = 0>
+    JsonValue& operator[](T&& key) {
+        // key为数字
+        if (!isArray()) {
+            destroyValue();
+            m_type        = JsonType::Array;
+            m_value.array = new JsonArray();
+        }
+        auto& arr = *m_value.array;
+        if (key >= 0) {
+            if (static_cast<size_t>(key) >= arr.size()) {
+                arr.resize(key + 1);
+            }
+            return arr[key];
+        }
+        throw JsonException("Negative Array index");
+    }
+
+    /**
+     * @brief 访问对象属性（可读写）
+     * @param T 键类型（任何可以转换为 std::string_view 的类型，键已存在时不复制；
+     *          JsonKey 使用预先计算的哈希值）
+     * @param key 参数类型 T。
+     * @return 对象中对应键的 JsonValue 引用。
+     */
+    template <typename T, std::enable_if_t<IsObjectKey<T>::value, int> = 0>
+    JsonValue& operator[](T&& key) {
+        if (!isObject()) {
+            destroyValue();
+            m_type         = JsonType::Object;
+            m_value.object = new JsonObject;
+        }
+        return (*m_value.object)[std::forward<T>(key)];
+    }
+
+    /**
+     * @brief 访问数组元素（只读读）
+     * @param T 数组索引（整数类型）
+     * @param key 参数类型 T。
+     * @return 数组中对应索引的 JsonValue 常量引用值。
+     * @exception std::out_of范围 如果索引超出范围。
+     * @exception std::runtime_error 如果不是数组。
+     */
+    template <typename T, std::enable_if_t<std::is_integral_v<std::remove_reference_t<T>>, int> = 0>
+    const JsonValue& operator[](T&& key) const {
+        if (!isArray()) {
+            throw JsonException("Not an Array");
+        }
+        auto& arr = *m_value.array;
+        if (key >= 0 && static_cast<size_t>(key) < arr.size()) {
+            return arr[key];
+        }
+        throw JsonException("Array index out of range");
+    }
+
+    /**
+     * @brief 访问对象属性（只读）
+     * @param key 参数类型 T 键类型（任何可以转换为 std::string_view 的类型，查找时不构造临时的键；
+     *            JsonKey 使用预先计算的哈希值）
+     * @return 对象中对应键的 JsonValue 常量引用值。
+     * @exception std::out_of范围 如果键不存在。
+     * @exception std::runtime_error 如果不是对象。
+     */
+    template <typename T, std::enable_if_t<IsObjectKey<T>::value, int> = 0>
+    const JsonValue& operator[](T&& key) const {
+        if (!isObject()) {
+            throw JsonException("Not an Object");
+        }
+        auto it = m_value.object->find(key);
+        if (it != m_value.object->end()) {
+            return it->second;
+        }
+        throw JsonException("Key not found");
+    }
+
+    /**
+     * @brief 将 JSON 值转换为字符串表示。
+     * @param indent 缩进空格数（默认 0，表示无缩进）
+     * @return JSON 值的字符串表示。
+     */
+    std::string toString(int indent = 0) const;
+
+    /**
+     * @brief 输出 JSON 值到流。
+     * @param os 输出流。
+     * @param value JSON 值。
+     * @return 输出流引用。
+     */
+    friend std::ostream& operator<<(std::ostream& os, const JsonValue& value) {
+        os << value.toString();
+        return os;
+    }
+
+  private:
+    /**
+     * @brief 通用迭代器模板类，用于遍历 JSON 数据结构（对象或数组）。
+     * @tparam T 迭代器操作的值类型（通常为 JsonValue）。
+     * @tparam IsConst 是否为常量迭代器（true 表示 const，false 表示非 const）。
+     */
+    template <typename T, bool IsConst>
+    class BaseIterator {
+      public:
+        using value_type = std::conditional_t<IsConst, const T, T>;  ///< 迭代器指向的值类型。
+        using pointer         = value_type*;                        ///< 指向值的指针类型。
+        using reference       = value_type&;                        ///< 值的引用类型。
+        using difference_type = std::ptrdiff_t;                     ///< 迭代器差值类型。
+        using iterator_category = std::bidirectional_iterator_tag;  ///< 迭代器类别（双向迭代器）。
+
+        using ObjectIterator = std::conditional_t<IsConst,
+                                                  JsonObject::const_iterator,
+                                                  JsonObject::iterator>;  ///< 对象迭代器类型。
+        using ArrayIterator  = std::conditional_t<IsConst,
+                                                  JsonArray::const_iterator,
+                                                  JsonArray::iterator>;  ///< 数组迭代器类型。
+
+        /**
+         * @brief 构造函数，初始化迭代器。
+         * @param value 指向的 JSON 值（对象、数组或基本类型）。
+         * @param end 是否为结束迭代器（true 表示结束位置，false 表示起始位置）。
+         */
+        BaseIterator(std::conditional_t<IsConst, const T*, T*> value, bool end = false)
+            : m_value(value) {
+            if (value->isObject()) {
+                m_it = end ? value->m_value.object->end() : value->m_value.object->begin();
+            } else if (value->isArray()) {
+                m_it = end ? value->m_value.array->end() : value->m_value.array->begin();
+            } else {
+                m_it = end ? static_cast<size_t>(1) : 0;
+            }
+        }
+
+        /**
+         * @brief 解引用操作符，返回当前迭代器指向的值。
+         * @return 当前值的引用。
+         */
+        reference operator*() const {
+            if (m_value->isObject()) {
+                return std::get<ObjectIterator>(m_it)->second;
+            } else if (m_value->isArray()) {
+                return *std::get<ArrayIterator>(m_it);
+            } else {
+                return *m_value;
+            }
+        }
+
+        /**
+         * @brief 箭头操作符，返回当前迭代器指向值的指针。
+         * @return 指向当前值的指针。
+         */
+        pointer operator->() const {
+            return &this->operator*();
+        }
+
+        /**
+         * @brief 前置递增操作符，移动到下一个元素。
+         * @return 当前迭代器的引用。
+         */
+        BaseIterator& operator++() {
+            if (m_value->isObject()) {
+                ++std::get<ObjectIterator>(m_it);
+            } else if (m_value->isArray()) {
+                ++std::get<ArrayIterator>(m_it);
+            } else {
+                ++std::get<size_t>(m_it);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief 后置递增操作符，移动到下一个元素并返回原迭代器副本。
+         * @return 原迭代器的副本。
+         */
+        BaseIterator operator++(int) {
+            BaseIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        /**
+         * @brief 前置递减操作符，移动到上一个元素。
+         * @return 当前迭代器的引用。
+         */
+        BaseIterator& operator--() {
+            if (m_value->isObject()) {
+                --std::get<ObjectIterator>(m_it);
+            } else if (m_value->isArray()) {
+                --std::get<ArrayIterator>(m_it);
+            } else {
+                --std::get<size_t>(m_it);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief 后置递减操作符，移动到上一个元素并返回原迭代器副本。
+         * @return 原迭代器的副本。
+         */
+        BaseIterator operator--(int) {
+            BaseIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        /**
+         * @brief 比较两个迭代器是否相等。
+         * @param other 另一个迭代器。
+         * @return 如果两个迭代器指向相同位置，返回 true，否则返回 false。
+         */
+        bool operator==(const BaseIterator& other) const {
+            if (m_value != other.m_value) {
+                return false;
+            }
+            if (m_value->isObject()) {
+                return std::get<ObjectIterator>(m_it) == std::get<ObjectIterator>(other.m_it);
+            } else if (m_value->isArray()) {
+                return std::get<ArrayIterator>(m_it) == std::get<ArrayIterator>(other.m_it);
+            } else {
+                return std::get<size_t>(m_it) == std::get<size_t>(other.m_it);
+            }
+        }
+
+        /**
+         * @brief 比较两个迭代器是否不相等。
+         * @param other 另一个迭代器。
+         * @return 如果两个迭代器指向不同位置，返回 true，否则返回 false。
+         */
+        bool operator!=(const BaseIterator& other) const {
+            return !(this->operator==(other));
+        }
+
+        /**
+         * @brief 获取当前对象迭代器的键（仅适用于对象类型）。
+         * @return 当前键的字符串。
+         * @throws JsonException 如果迭代器不指向对象类型。
+         */
+        std::string key() const {
+            if (!m_value->isObject()) {
+                throw JsonException("Not an object iterator");
+            }
+            return std::get<ObjectIterator>(m_it)->first;
+        }
+
+        /**
+         * @brief 获取当前迭代器的值。
+         * @return 当前值的引用。
+         */
+        reference value() const {
+            return operator*();
+        }
+
+      private:
+        std::conditional_t<IsConst, const T*, T*> m_value = nullptr;  ///< 指向的 JSON 值。
+        std::variant<ObjectIterator, ArrayIterator, size_t>
+            m_it;  ///< 内部迭代器（对象、数组或基本类型的索引）。
+    };
+
+    /**
+     * @brief 非 const 迭代器类型，用于遍历可修改的 JsonValue。
+     */
+    using Iterator = BaseIterator<JsonValue, false>;
+
+    /**
+     * @brief const 迭代器类型，用于遍历不可修改的 JsonValue。
+     */
+    using ConstIterator = BaseIterator<JsonValue, true>;
+
+    /**
+     * @brief 反向迭代器模板类，用于反向遍历 JSON 数据结构。
+     * @tparam ForwardIt 正向迭代器类型。
+     */
+    template <typename ForwardIt>
+    class BaseReverseIterator {
+      public:
+        using value_type = typename ForwardIt::value_type;  ///< 反向迭代器指向的值类型。
+        using reference       = typename ForwardIt::reference;  ///< 值的引用类型。
+        using pointer         = typename ForwardIt::pointer;    ///< 指向值的指针类型。
+        using difference_type = typename ForwardIt::difference_type;  ///< 迭代器差值类型。
+        using iterator_category = std::bidirectional_iterator_tag;  ///< 迭代器类别（双向迭代器）。
+
+        /**
+         * @brief 构造函数，初始化反向迭代器。
+         * @param it 正向迭代器，用于初始化反向迭代器。
+         */
+        explicit BaseReverseIterator(ForwardIt it) : m_it(std::move(it)) {}
+
+        /**
+         * @brief 解引用操作符，返回当前反向迭代器指向的值。
+         * @return 当前值的引用。
+         */
+        reference operator*() const {
+            auto tmp = m_it;
+            return *--tmp;
+        }
+
+        /**
+         * @brief 箭头操作符，返回当前反向迭代器指向值的指针。
+         * @return 指向当前值的指针。
+         */
+        pointer operator->() const {
+            auto tmp = m_it;
+            return &*--tmp;
+        }
+
+        /**
+         * @brief 前置递增操作符，移动到上一个元素（反向遍历）。
+         * @return 当前反向迭代器的引用。
+         */
+        BaseReverseIterator& operator++() {
+            --m_it;
+            return *this;
+        }
+
+        /**
+         * @brief 后置递增操作符，移动到上一个元素并返回原迭代器副本。
+         * @return 原反向迭代器的副本。
+         */
+        BaseReverseIterator operator++(int) {
+            BaseReverseIterator tmp = *this;
+            --m_it;
+            return tmp;
+        }
+
+        /**
+         * @brief 前置递减操作符，移动到下一个元素（反向遍历）。
+         * @return 当前反向迭代器的引用。
+         */
+        BaseReverseIterator& operator--() {
+            ++m_it;
+            return *this;
+        }
+
+        /**
+         * @brief 后置递减操作符，移动到下一个元素并返回原迭代器副本。
+         * @return 原反向迭代器的副本。
+         */
+        BaseReverseIterator operator--(int) {
+            BaseReverseIterator tmp = *this;
+            ++m_it;
+            return tmp;
+        }
+
+        /**
+         * @brief 比较两个反向迭代器是否相等。
+         * @param other 另一个反向迭代器。
+         * @return 如果两个反向迭代器指向相同位置，返回 true，否则返回 false。
+         */
+        bool operator==(const BaseReverseIterator& other) const {
+            return m_it == other.m_it;
+        }
+
+        /**
+         * @brief 比较两个反向迭代器是否不相等。
+         * @param other 另一个反向迭代器。
+         * @return 如果两个反向迭代器指向不同位置，返回 true，否则返回 false。
+         */
+        bool operator!=(const BaseReverseIterator& other) const {
+            return m_it != other.m_it;
+        }
+
+        /**
+         * @brief 获取当前对象反向迭代器的键（仅适用于对象类型）。
+         * @return 当前键的字符串。
+         * @throws JsonException 如果迭代器不指向对象类型。
+         */
+        std::string key() const {
+            auto tmp = m_it;
+            return (--tmp).key();
+        }
+
+        /**
+         * @brief 获取当前反向迭代器的值。
+         * @return 当前值的引用。
+         */
+        reference value() const {
+            auto tmp = m_it;
+            return (--tmp).value();
+        }
+
+      private:
+        ForwardIt m_it;  ///< 内部正向迭代器。
+    };
+
+    /**
+     * @brief 非 const 反向迭代器类型，用于反向遍历可修改的 JsonValue。
+     */
+    using ReverseIterator = BaseReverseIterator<Iterator>;
+
+    /**
+     * @brief const 反向迭代器类型，用于反向遍历不可修改的 JsonValue。
+     */
+    using ConstReverseIterator = BaseReverseIterator<ConstIterator>;
+
+  public:
+    /**
+     * @brief 获取 JSON 数据结构的正向迭代器（非 const），指向起始位置。
+     * @return Iterator 类型的迭代器，指向 JSON 数据的开头。
+     */
+    Iterator begin() {
+        return {this};
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的正向迭代器（非 const），指向结束位置。
+     * @return Iterator 类型的迭代器，指向 JSON 数据的末尾。
+     */
+    Iterator end() {
+        return {this, true};
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的反向迭代器（非 const），指向反向遍历的起始位置（即正向的末尾）。
+     * @return ReverseIterator 类型的反向迭代器，指向 JSON 数据的末尾。
+     */
+    ReverseIterator rbegin() {
+        return ReverseIterator(end());
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的反向迭代器（非 const），指向反向遍历的结束位置（即正向的开头）。
+     * @return ReverseIterator 类型的反向迭代器，指向 JSON 数据的开头。
+     */
+    ReverseIterator rend() {
+        return ReverseIterator(begin());
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的正向迭代器（const），指向起始位置。
+     * @return ConstIterator 类型的迭代器，指向 JSON 数据的开头。
+     */
+    ConstIterator begin() const {
+        return {this};
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的正向迭代器（const），指向结束位置。
+     * @return ConstIterator 类型的迭代器，指向 JSON 数据的末尾。
+     */
+    ConstIterator end() const {
+        return {this, true};
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的反向迭代器（const），指向反向遍历的起始位置（即正向的末尾）。
+     * @return ConstReverseIterator 类型的反向迭代器，指向 JSON 数据的末尾。
+     */
+    ConstReverseIterator rbegin() const {
+        return ConstReverseIterator(end());
+    }
+
+    /**
+     * @brief 获取 JSON 数据结构的反向迭代器（const），指向反向遍历的结束位置（即正向的开头）。
+     * @return ConstReverseIterator 类型的反向迭代器，指向 JSON 数据的开头。
+     */
+    ConstReverseIterator rend() const {
+        return ConstReverseIterator(begin());
+    }
+
+  private:
+    /**
+     * @brief 释放内部存储的动态内存。
+     * @note 嵌套较深的部分先逐层移出再析构，任意深度的值都不会栈溢出。
+     */
+    void destroyValue() noexcept;
+
+    /**
+     * @brief 用显式栈深拷贝数组或对象 other（当前值尚未持有任何内存），不递归。
+     * @param other 要拷贝的数组或对象。
+     * @note 拷贝构造函数在嵌套较深时调用，任意深度的值都不会栈溢出。
+     */
+    void copyContainer(const JsonValue& other);
+
+  private:
+    /**
+     * @enum Storage
+     * @brief 字符串的存储方式。
+     */
+    enum class Storage : uint8_t {
+        Heap,               ///< 字符串为堆上分配的 JsonString（m_value.string），数字为转换后的值
+        Borrowed,           ///< 字符串或数字的原始文本引用外部内存（m_value.view，长度为 m_length）
+        HeapText,           ///< 数字的原始文本保存在堆上分配的字符数组中（m_value.view，长度为 m_length）
+        Arena,              ///< 数组或对象本身位于 Document 的 arena 中，销毁时只析构不释放
+        InlineString = 0x10 ///< 短字符串或短数字文本保存在值内部，低 4 位为长度（见 inlineString()）
+    };
+
+    /**
+     * @brief 字符串是否保存在值内部。
+     */
+    bool isInlineString() const noexcept {
+        return static_cast<uint8_t>(m_storage) >= static_cast<uint8_t>(Storage::InlineString);
+    }
+
+    /**
+     * @brief 值内部保存的短字符串的长度。
+     */
+    size_t inlineStringLength() const noexcept {
+        return static_cast<uint8_t>(m_storage) & 0x0F;
+    }
+
+    /**
+     * @brief 值内部保存短字符串的位置：从 m_small 开始，依次占用 m_length 与 m_value，
+     *        共 INLINE_STRING_CAPACITY 个字节（JsonValue 是标准布局类型，见类定义之后的断言）
+     */
+    char* inlineString() noexcept {
+        return reinterpret_cast<char*>(this) + sizeof(JsonType) + sizeof(Storage);
+    }
+
+    const char* inlineString() const noexcept {
+        return reinterpret_cast<const char*>(this) + sizeof(JsonType) + sizeof(Storage);
+    }
+
+    /**
+     * @brief 保存字符串：不超过 INLINE_STRING_CAPACITY 字节时保存在值内部，否则在堆上分配。
+     * @param value 字符串。
+     */
+    void setString(std::string_view value);
+
+    /**
+     * @brief 将引用外部内存或保存在值内部的字符串转换为堆上分配的 JsonString。
+     * @return 堆上的字符串。
+     * @note 字符串内容不变，因此允许在 const 对象上进行（存储成员声明为 mutable）
+     */
+    JsonString& ownString() const;
+
+    /**
+     * @brief 复制一份数字的原始文本：不超过 INLINE_STRING_CAPACITY 字节时保存在值内部，
+     *        否则在堆上分配一个字符数组（只分配一次）
+     * @param text 合法的 JSON 数字文本。
+     */
+    void setNumberText(std::string_view text);
+
+    /**
+     * @brief 获取整数值，延迟解析的数字在此时从原始文本转换。
+     */
+    int64_t integerValue() const noexcept {
+        return m_storage == Storage::Heap ? m_value.iNumber : textToInteger();
+    }
+
+    /**
+     * @brief 获取浮点值，延迟解析的数字在此时从原始文本转换。
+     */
+    double doubleValue() const noexcept {
+        return m_storage == Storage::Heap ? m_value.dNumber : textToDouble();
+    }
+
+    /**
+     * @brief 将整数的原始文本转换为 int64_t（解析时已经确认不会溢出）
+     */
+    int64_t textToInteger() const noexcept;
+
+    /**
+     * @brief 将数字的原始文本转换为 double（解析时已经确认不会超出范围）
+     */
+    double textToDouble() const noexcept;
+
+    friend struct LazyNumber;
+    friend struct ArenaValue;
+
+    // 存储相关的成员声明为 mutable：const 的 asString() 会把字符串转换为堆上的 JsonString
+    JsonType         m_type;                      ///< JSON 数据类型
+    mutable Storage  m_storage = Storage::Heap;  ///< 字符串、数字或容器的存储方式
+    mutable char     m_small[2]{};               ///< 值内部保存的短字符串的前两个字节
+    mutable uint32_t m_length  = 0;              ///< 引用外部内存的字符串或数字文本的长度
+    mutable union
+    {
+        bool        boolean;  ///< 布尔值
+        int64_t     iNumber;  ///< 整数值
+        double      dNumber;  ///< 浮点值
+        JsonString* string;   ///< 字符串指针
+        const char* view;     ///< 引用的外部字符串，或堆上分配的数字文本
+        JsonArray*  array;    ///< 数组指针
+        JsonObject* object;   ///< 对象指针
+    } m_value{};              ///< 存储值的联合体
+};
+
+static_assert(sizeof(JsonValue) == 16, "JsonValue must stay 16 bytes");
+static_assert(std::is_standard_layout_v<JsonValue>,
+              "inline strings rely on the standard layout of JsonValue");
+
+/**
+ * @class JsonHandler
+ * @brief SAX 风格的解析事件接口。
+ *
+ * 解析器按文档顺序回调各个方法，不构建 DOM。任一回调返回 false 时解析立即停止。
+ * 默认实现忽略事件并继续解析，派生类只需重写关心的事件。
+ * 字符串和键以 std::string_view 传入，只在回调期间有效。
+ */
+class JsonHandler {
+  public:
+    virtual ~JsonHandler() = default;
+
+    /**
+     * @brief 空值。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onNull() {
+        return true;
+    }
+
+    /**
+     * @brief 布尔值。
+     * @param value 布尔值。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onBool(bool /*value*/) {
+        return true;
+    }
+
+    /**
+     * @brief 可以表示为 int64_t 的整数。
+     * @param value 整数值。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onInt64(int64_t /*value*/) {
+        return true;
+    }
+
+    /**
+     * @brief 浮点数，以及超出 int64_t 范围的整数。
+     * @param value 浮点值。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onDouble(double /*value*/) {
+        return true;
+    }
+
+    /**
+     * @brief 字符串值（已反转义）
+     * @param value 字符串内容，只在回调期间有效。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onString(std::string_view /*value*/) {
+        return true;
+    }
+
+    /**
+     * @brief 对象的键（已反转义），随后是该成员的值。
+     * @param key 键的内容，只在回调期间有效。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onKey(std::string_view /*key*/) {
+        return true;
+    }
+
+    /**
+     * @brief 对象开始。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onStartObject() {
+        return true;
+    }
+
+    /**
+     * @brief 对象结束。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onEndObject() {
+        return true;
+    }
+
+    /**
+     * @brief 数组开始。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onStartArray() {
+        return true;
+    }
+
+    /**
+     * @brief 数组结束。
+     * @return 返回 false 时停止解析。
+     */
+    virtual bool onEndArray() {
+        return true;
+    }
+};
+
+/**
+ * @class StringPool
+ * @brief 字符串池：相同内容的字符串只保存一份。
+ *
+ * 字符串按块追加到池自己的存储中，地址在池的生命周期内保持不变，池只增不减，直到 clear()。
+ * parser::parseInterned 把对象的键（以及不超过 maxValueLength() 字节的字符串值）放入池中，
+ * 树中只保存对池的引用，重复出现的键和短字符串因此共享同一份存储。
+ * 同一个池可以被多个文档共享，以便在文档之间去重。
+ *
+ * intern() 本身不加锁；StringPool 满足 Lockable，需要在多个线程中共享时先锁定池
+ * （parseInterned 在解析期间自动锁定）
+ */
+class StringPool {
+  public:
+    /**
+     * @struct Stats
+     * @brief 去重统计。
+     */
+    struct Stats {
+        size_t lookups    = 0;  ///< intern() 的调用次数
+        size_t hits       = 0;  ///< 命中已有字符串的次数
+        size_t strings    = 0;  ///< 池中不同字符串的个数
+        size_t bytes      = 0;  ///< 池中字符串的总字节数
+        size_t savedBytes = 0;  ///< 命中已有字符串而省下的字节数
+    };
+
+    /**
+     * @brief 构造空的字符串池。
+     * @param maxValueLength parseInterned 放入池中的字符串值的最大长度，0 表示只放入键。
+     */
+    explicit StringPool(size_t maxValueLength = DEFAULT_MAX_VALUE_LENGTH) noexcept
+        : m_maxValueLength(maxValueLength) {}
+
+    StringPool(const StringPool&)            = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    static constexpr size_t DEFAULT_MAX_VALUE_LENGTH = 32;  ///< 默认的字符串值最大长度
+
+    /**
+     * @brief 获取字符串在池中的唯一副本，不存在时先复制到池中。
+     * @param value 字符串。
+     * @return 池中的副本，在池被销毁或 clear() 之前有效。
+     */
+    std::string_view intern(std::string_view value);
+
+    /**
+     * @brief 获取去重统计。
+     * @return 当前的统计信息。
+     */
+    const Stats& stats() const noexcept {
+        return m_stats;
+    }
+
+    /**
+     * @brief parseInterned 放入池中的字符串值的最大长度。
+     * @return 最大长度，0 表示只放入键。
+     */
+    size_t maxValueLength() const noexcept {
+        return m_maxValueLength;
+    }
+
+    /**
+     * @brief 清空池并释放存储，之前返回的所有引用都会失效。
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 锁定池（Lockable）
+     */
+    void lock() {
+        m_mutex.lock();
+    }
+
+    /**
+     * @brief 解锁池（Lockable）
+     */
+    void unlock() {
+        m_mutex.unlock();
+    }
+
+    /**
+     * @brief 尝试锁定池（Lockable）
+     * @return 锁定成功返回 true。
+     */
+    bool try_lock() {
+        return m_mutex.try_lock();
+    }
+
+  private:
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;  ///< 存储块的默认大小
+
+    std::unordered_set<std::string_view> m_strings;         ///< 池中的字符串
+    std::vector<std::unique_ptr<char[]>> m_blocks;          ///< 存储块
+    std::vector<std::unique_ptr<char[]>> m_large;           ///< 单独分配的较长字符串
+    size_t                               m_free = 0;        ///< 最后一个存储块的剩余字节数
+    size_t                               m_maxValueLength;  ///< 放入池中的字符串值的最大长度
+    Stats                                m_stats;           ///< 去重统计
+    std::mutex                           m_mutex;           ///< 多线程共享时使用的锁
+};
+
+/**
+ * @brief JSON 字符串解析和序列化。
+ *
+ * 提供静态方法用于将 JSON 字符串解析为 JsonValue 对象，以及将 JsonValue 对象序列化为 JSON 字符串。
+ * 支持扩展解析选项（如 \\x 和 \\0 转义序列）。
+ */
+namespace parser {
+    /**
+     * @enum ParserOption
+     * @brief JSON 解析选项枚举。
+     *
+     * 定义解析 JSON 时的可选配置项，用于控制扩展功能。
+     */
+    enum ParserOption {
+        DISABLE_EXTENSION              = 0,       ///< 禁用所有扩展
+        ENABLE_PARSE_X_ESCAPE_SEQUENCE = 1,       ///< 启用 \x 转义序列解析
+        ENABLE_PARSE_0_ESCAPE_SEQUENCE = 1 << 1,  ///< 启用 \0 转义序列解析
+        // 1 << 2 保留：曾是已移除的两阶段（结构索引）解析选项，不再分配给其他选项，
+        // 以数值传入该位的旧代码不会被解释为别的功能
+        ENABLE_LAZY_NUMBER             = 1 << 3,  ///< 数字保留原始文本用于透传，读取时才转换
+        ENABLE_ARENA                   = 1 << 4   ///< Document 的全部节点从它持有的 arena 中分配
+    };
+
+    /**
+     * @struct ParserOptions
+     * @brief JSON 解析配置：扩展选项与嵌套深度限制。
+     *
+     * 可以由 ParserOption 隐式构造，因此 parse(json, option) 的写法保持不变。
+     */
+    struct ParserOptions {
+        static constexpr size_t DEFAULT_MAX_DEPTH = 1024;  ///< 默认的最大嵌套深度
+
+        uint8_t flags;     ///< ParserOption 的按位组合
+        size_t  maxDepth;  ///< 数组/对象的最大嵌套深度，0 表示不限制
+
+        /**
+         * @brief 构造解析配置。
+         * @param option 解析选项（默认禁用扩展）
+         * @param depth 数组/对象的最大嵌套深度（默认 DEFAULT_MAX_DEPTH，0 表示不限制）
+         * @note 解析、拷贝、析构和序列化任意深度的值都不会栈溢出，0 是安全的，
+         *       但不可信的输入仍可能用深层嵌套消耗大量内存。
+         */
+        ParserOptions(ParserOption option = DISABLE_EXTENSION, size_t depth = DEFAULT_MAX_DEPTH)
+            : flags(static_cast<uint8_t>(option)), maxDepth(depth) {}
+    };
+
+    /**
+     * @brief 从 JSON 字符串解析为 JsonValue。
+     *
+     * 解析使用显式的容器栈而不是递归，栈在同一线程的多次解析之间复用；
+     * 嵌套深度超过 options.maxDepth 时抛出异常。
+     *
+     * 启用 ENABLE_LAZY_NUMBER 时，数字只做校验，保留原始文本，在 get<T>() 等读取时才转换，
+     * 序列化时原样输出原始文本。数字的类型（Integer/Double）和错误信息与立即转换时相同。
+     * 通过 parse 解析时，不超过 JsonValue::INLINE_STRING_CAPACITY 字节的数字文本保存在值内部，
+     * 更长的整数直接转换（文本与转换结果一一对应），只有更长的浮点数文本需要单独分配一次，
+     * 这类数字密集的文档（如 canada.json）比立即转换更慢；与 parseDocument 一起使用时
+     * 原始文本直接引用输入缓冲区，不分配内存。
+     * @param json JSON 输入字符串。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 解析结果的 JsonValue 对象。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
+     */
+    JsonValue parse(std::string_view json, const ParserOptions& options = {});
+
+    /**
+     * @brief 解析 JSON 字符串，失败时不抛出异常。
+     *
+     * 与 parse 的结果和错误完全相同，但解析错误通过 error 返回：只记录错误类型和位置，
+     * 不分配内存，需要错误描述时再调用 error.message()。适合输入经常无效的场景。
+     * 内存不足等非解析错误仍然以异常报告。
+     * @param json JSON 输入字符串。
+     * @param out 解析结果（输出参数，失败时不修改）
+     * @param error 解析错误（输出参数，成功时不修改）
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 解析成功返回 true。
+     */
+    bool tryParse(std::string_view     json,
+                  JsonValue&           out,
+                  ParseError&          error,
+                  const ParserOptions& options = {});
+
+    /**
+     * @brief 校验 JSON 字符串，不构建 DOM。
+     *
+     * 与 parse 使用相同的语法检查（parse 成功的输入必然通过校验），此外还检查输入是否为
+     * 有效的 UTF-8。字符串只校验不保存，除嵌套超过 64 层的容器外不分配内存。
+     * @param json JSON 输入字符串。
+     * @param error 校验错误（输出参数，成功时不修改）
+     * @param options 解析配置，其中 ENABLE_LAZY_NUMBER 不影响结果。
+     * @return 输入是有效的 JSON 时返回 true。
+     */
+    bool validate(std::string_view json, ParseError& error, const ParserOptions& options = {});
+
+    /**
+     * @brief 校验 JSON 字符串，不构建 DOM。
+     * @param json JSON 输入字符串。
+     * @param options 解析配置。
+     * @return 输入是有效的 JSON 时返回 true。
+     * @see validate(std::string_view, ParseError&, const ParserOptions&)
+     */
+    bool validate(std::string_view json, const ParserOptions& options = {});
+
+    /**
+     * @brief 解析 JSON 字符串，对象的键和短字符串值放入字符串池中去重。
+     *
+     * 树中的键以及不超过 pool->maxValueLength() 字节的字符串值都引用池中的唯一副本，
+     * 重复出现的键和值不再各自分配；更长的字符串与 parse 相同地单独保存。
+     * 返回的 Document 只持有池的一份共享引用而不保留输入，适合长期缓存的文档。
+     * 结果和错误与 parse 完全相同。解析期间锁定 pool，因此同一个池可以在多个线程中共享。
+     * @param json JSON 输入字符串。
+     * @param pool 字符串池，为空时为该文档单独创建一个池。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 引用字符串池的 Document，其 buffer() 为空。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
+     */
+    Document parseInterned(std::string_view            json,
+                           std::shared_ptr<StringPool> pool    = nullptr,
+                           const ParserOptions&        options = {});
+
+    /**
+     * @brief 以 SAX 方式解析 JSON 字符串，将解析事件交给 handler 而不构建 DOM。
+     *
+     * 与 parse 使用同一个词法分析器（parse 本身就是构建 DOM 的事件处理器），
+     * 语法检查、嵌套深度限制和错误信息完全相同；除了含转义字符的字符串使用一块复用的缓冲区外，
+     * 解析过程不为每个节点分配内存。handler 返回 false 时立即停止，不再检查之后的内容。
+     * 该接口忽略 ENABLE_LAZY_NUMBER。
+     * @param json JSON 输入字符串。
+     * @param handler 事件处理器。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 完整解析返回 true；handler 要求停止时返回 false。
+     * @exception JsonParseException 如果在停止之前遇到语法错误，抛出异常，包含错误信息和位置。
+     */
+    bool parse(std::string_view json, JsonHandler& handler, const ParserOptions& options = {});
+
+    /**
+     * @brief 将 JsonValue 序列化为 JSON 字符串。
+     * @param value 要序列化的 JSON 值。
+     * @param indent 缩进空格数（默认 0，表示无缩进）
+     * @return 序列化的 JSON 字符串。
+     * @exception JsonException 如果序列化失败（如数值无效），抛出异常。
+     */
+    std::string stringify(const JsonValue& value, int indent = 0);
+
+    /**
+     * @brief 以零拷贝方式解析 JSON 字符串，返回持有输入缓冲区的 Document。
+     *
+     * 不含转义字符的字符串值和对象键直接引用输入缓冲区，不复制也不分配内存，
+     * 只有含转义字符的字符串才会反转义到自己的存储中。输入字符串被移动到 Document 内部，
+     * 因此这些引用在 Document 存活期间始终有效。
+     * 启用 ENABLE_ARENA 时，数组、对象（包括它们的元素存储）以及含转义字符的字符串都从
+     * Document 持有的单调 arena 中分配，解析过程几乎不调用 operator new，销毁时也不逐个释放。
+     * @param json JSON 输入字符串（被移动到返回的 Document 中）
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 持有输入缓冲区和解析结果的 Document。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
+     */
+    Document parseDocument(std::string json, const ParserOptions& options = {});
+
+    /**
+     * @brief 以零拷贝方式解析由调用者管理的缓冲区。
+     *
+     * 与 parseDocument(std::string, ...) 相同，但输入不会被复制：Document 保存 owner 的一份
+     * 共享引用，调用者需保证 owner 存活期间 json 指向的内容不被修改或释放
+     * （例如 owner 持有一段内存映射或一个 std::vector<char>）。
+     * @param json JSON 输入，必须指向 owner 所管理的内存。
+     * @param owner 输入缓冲区的所有者，可以为空（此时由调用者保证缓冲区比 Document 活得久）
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 引用输入缓冲区的 Document。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
+     */
+    Document parseDocument(std::string_view             json,
+                           std::shared_ptr<const void> owner,
+                           const ParserOptions&        options = {});
+
+    /**
+     * @brief 在调用者提供的可写缓冲区中原地解析（破坏性解析）
+     *
+     * 与 parseDocument 相同，字符串和键直接引用缓冲区；含转义字符的字符串也在缓冲区中
+     * 原地反转义，同样不需要复制。只有扩展转义（\x、\0）展开后比原文更长时才会单独分配。
+     * 解析后缓冲区的内容会被改写（无论成功与否），调用者需保证缓冲区比返回的 Document 活得久。
+     * @param buf 可写的输入缓冲区。
+     * @param len 输入长度。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 引用 buf 的 Document。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
+     */
+    Document parseInSitu(char* buf, size_t len, const ParserOptions& options = {});
+
+    /**
+     * @brief 解析文件。
+     *
+     * 按文件大小一次性读入 std::string 后解析，返回前释放读入的内容。
+     * 顺序读取整个文件时一次 read 比内存映射更快（映射需要逐页处理缺页），
+     * 需要零拷贝或降低内存占用时使用 parseDocumentFile。
+     * @param path 文件路径。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 解析结果。
+     * @exception JsonException 如果无法打开或读取文件，抛出异常。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
+     */
+    JsonValue parseFile(const std::string& path, const ParserOptions& options = {});
 
     /**
-     * @brief 访问数组元素（可读写）
-     * @param T 数组索引（整数）
-     * @param key 参数类型（整数）
-     * @return 数组中对应索引的 JsonValue 引用。
-     * @exception std::out_of_range 如果索引为负数。
+     * @brief 零拷贝地解析文件。
+     *
+     * 文件以只读方式映射到内存（POSIX 上使用 mmap），再按 parseDocument 的方式解析：
+     * 树中的字符串和键直接引用映射的内容，映射由返回的 Document 持有，
+     * 直到 Document 销毁时才解除。文件内容不占用堆内存，内存紧张时可以被内核回收，
+     * 适合降低大文件的内存占用；
+     * 只追求速度时 parseFile（或读入后 parseDocument）通常更快。
+     * 文件在 Document 的生命周期内不应被截断或改写。
+     * @param path 文件路径。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 引用文件映射的 Document。
+     * @exception JsonException 如果无法打开或映射文件，抛出异常。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
      */
-    template <typename T, std::enable_if_t<std::is_integral_v<std::remove_reference_t<T>>, int> = 0>
-    JsonValue& operator[](T&& key) {
-        // key为数字
-        if (!isArray()) {
-            destroyValue();
-            m_type        = JsonType::Array;
-            m_value.array = new JsonArray();
-        }
-        auto& arr = *m_value.array;
-        if (key >= 0) {
-            if (static_cast<size_t>(key) >= arr.size()) {
-                arr.resize(key + 1);
-            }
-            return arr[key];
-        }
-        throw JsonException("Negative Array index");
-    }
+    Document parseDocumentFile(const std::string& path, const ParserOptions& options = {});
+}  // namespace parser
+
+/**
+ * @class Document
+ * @brief 零拷贝解析的结果：输入缓冲区与引用它的 JsonValue 树。
+ *
+ * 树中的字符串和键可能直接引用缓冲区，因此 Document 只能移动不能拷贝。
+ * 从 Document 中拷贝出的 JsonValue（包括 get<std::string>() 等）总是拥有自己的数据，
+ * 可以在 Document 销毁后继续使用；移动出的 JsonValue 则仍然引用缓冲区，
+ * 不能比 Document 活得久。修改树中的字符串时会先将其复制为独立的存储。
+ * parser::parseInterned 得到的 Document 引用的是字符串池而不是输入缓冲区，规则相同。
+ *
+ * 以 parser::ENABLE_ARENA 解析时，树中的节点位于 Document 持有的单调 arena 中：
+ * 销毁时节点只被析构而不逐个释放，最后一次性释放整个 arena。修改树时新增的元素同样从
+ * arena 中分配，直到 Document 销毁才会释放，因此 arena 适合只读或很少修改的文档。
+ */
+class Document {
+  public:
+    Document()                                     = default;
+    Document(Document&&) noexcept                  = default;
+    Document(const Document&)                      = delete;
+    Document& operator=(const Document&)           = delete;
 
     /**
-     * @brief 访问对象属性（可读写）
-     * @param T 键类型（字符串或可转换为字符串）
-     * @param key 参数类型 T。
-     * @return 对象中对应键的 JsonValue 引用。
+     * @brief 移动赋值运算符，先销毁原有的树，再释放它引用的缓冲区和 arena。
      */
-    template <typename T,
-              std::enable_if_t<
-                  !std::is_integral_v<std::remove_reference_t<T>> &&
-                      (std::is_convertible_v<T, std::string> ||
-                       std::is_same_v<std::remove_cv_t<std::remove_reference_t<T>>, const char*>),
-                  int> = 0>
-    JsonValue& operator[](T&& key) {
-        if (!isObject()) {
-            destroyValue();
-            m_type         = JsonType::Object;
-            m_value.object = new JsonObject;
+    Document& operator=(Document&& other) noexcept {
+        if (this != &other) {
+            m_root   = JsonValue();
+            m_arena  = std::move(other.m_arena);
+            m_owner  = std::move(other.m_owner);
+            m_buffer = other.m_buffer;
+            m_root   = std::move(other.m_root);
         }
-        return (*m_value.object)[std::forward<T>(key)];
+        return *this;
     }
 
     /**
-     * @brief 访问数组元素（只读读）
-     * @param T 数组索引（整数类型）
-     * @param key 参数类型 T。
-     * @return 数组中对应索引的 JsonValue 常量引用值。
-     * @exception std::out_of范围 如果索引超出范围。
-     * @exception std::runtime_error 如果不是数组。
+     * @brief 获取根节点。
+     * @return 根节点的引用。
      */
-    template <typename T, std::enable_if_t<std::is_integral_v<std::remove_reference_t<T>>, int> = 0>
-    const JsonValue& operator[](T&& key) const {
-        if (!isArray()) {
-            throw JsonException("Not an Array");
-        }
-        auto& arr = *m_value.array;
-        if (key >= 0 && static_cast<size_t>(key) < arr.size()) {
-            return arr[key];
-        }
-        throw JsonException("Array index out of range");
+    JsonValue& root() noexcept {
+        return m_root;
     }
 
     /**
-     * @brief 访问对象属性（只读）
-     * @param key 参数类型 T 键类型（字符串或 C 风格字符串）
-     * @return 对象中对应键的 JsonValue 常量引用值。
-     * @exception std::out_of范围 如果键不存在。
-     * @exception std::runtime_error 如果不是对象。
+     * @brief 获取根节点（常量版本）
+     * @return 根节点的常量引用。
      */
-    template <typename T,
-              std::enable_if_t<
-                  !std::is_integral_v<std::remove_reference_t<T>> &&
-                      (std::is_convertible_v<T, std::string> ||
-                       std::is_same_v<std::remove_cv_t<std::remove_reference_t<T>>, const char*>),
-                  int> = 0>
-    const JsonValue& operator[](T&& key) const {
-        if (!isObject()) {
-            throw JsonException("Not an Object");
-        }
-        auto it = m_value.object->find(std::forward<T>(key));
-        if (it != m_value.object->end()) {
-            return it->second;
-        }
-        throw JsonException("Key not found");
+    const JsonValue& root() const noexcept {
+        return m_root;
     }
 
     /**
-     * @brief 将 JSON 值转换为字符串表示。
-     * @param indent 缩进空格数（默认 0，表示无缩进）
-     * @return JSON 值的字符串表示。
+     * @brief 获取被引用的输入缓冲区。
+     * @return 输入缓冲区。
      */
-    std::string toString(int indent = 0) const;
+    std::string_view buffer() const noexcept {
+        return m_buffer;
+    }
 
     /**
-     * @brief 输出 JSON 值到流。
-     * @param os 输出流。
-     * @param value JSON 值。
-     * @return 输出流引用。
+     * @brief 访问根对象的成员或根数组的元素。
+     * @param key 对象的键或数组的下标。
+     * @return 对应元素的常量引用。
+     * @exception JsonException 如果根节点类型不匹配或元素不存在，抛出异常。
      */
-    friend std::ostream& operator<<(std::ostream& os, const JsonValue& value) {
-        os << value.toString();
-        return os;
+    template <typename Key>
+    const JsonValue& operator[](Key&& key) const {
+        return m_root[std::forward<Key>(key)];
     }
 
   private:
+    friend Document parser::parseDocument(std::string json, const parser::ParserOptions& options);
+    friend Document parser::parseDocument(std::string_view             json,
+                                          std::shared_ptr<const void> owner,
+                                          const parser::ParserOptions& options);
+    friend Document parser::parseInSitu(char*                        buf,
+                                        size_t                       len,
+                                        const parser::ParserOptions& options);
+    friend Document parser::parseInterned(std::string_view             json,
+                                          std::shared_ptr<StringPool>  pool,
+                                          const parser::ParserOptions& options);
+
+    // 成员声明顺序保证 m_root 先于 m_owner 和 m_arena 析构
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> m_arena;   ///< 节点使用的 arena，可以为空
+    std::shared_ptr<const void>                          m_owner;   ///< 输入缓冲区（或字符串池）的所有者
+    std::string_view                                     m_buffer;  ///< 输入缓冲区
+    JsonValue                                            m_root;    ///< 解析结果
+};
+
+namespace parser {
     /**
-     * @brief 通用迭代器模板类，用于遍历 JSON 数据结构（对象或数组）。
-     * @tparam T 迭代器操作的值类型（通常为 JsonValue）。
-     * @tparam IsConst 是否为常量迭代器（true 表示 const，false 表示非 const）。
+     * @class PushParser
+     * @brief 增量（推送式）解析器：输入可以分成任意大小的块依次送入。
+     *
+     * 每个块到达后立即解析，块的边界可以落在字符串、转义序列（包括 \\u）、数字或字面量的中间，
+     * 只有被边界截断的那一个 token 会暂存下来，其余内容直接在块中解析而不复制。
+     * 完整的 token 使用与 parse 相同的扫描函数，结果、错误信息以及错误位置（整个输入中的偏移）
+     * 与一次性解析完整输入相同（个别 "Unexpected end of ..." 的描述可能不同）。
+     *
+     * 不传 handler 时构建 DOM，finish() 之后通过 root() 获取；传入 JsonHandler 时以 SAX 方式
+     * 解析，handler 返回 false 后 feed() 和 finish() 都返回 false。
+     * 解析失败（抛出异常）后不能继续使用。
      */
-    template <typename T, bool IsConst>
-    class BaseIterator {
+    class PushParser {
       public:
-        using value_type = std::conditional_t<IsConst, const T, T>;  ///< 迭代器指向的值类型。
-        using pointer         = value_type*;                        ///< 指向值的指针类型。
-        using reference       = value_type&;                        ///< 值的引用类型。
-        using difference_type = std::ptrdiff_t;                     ///< 迭代器差值类型。
-        using iterator_category = std::bidirectional_iterator_tag;  ///< 迭代器类别（双向迭代器）。
-
-        using ObjectIterator = std::conditional_t<IsConst,
-                                                  JsonObject::const_iterator,
-                                                  JsonObject::iterator>;  ///< 对象迭代器类型。
-        using ArrayIterator  = std::conditional_t<IsConst,
-                                                  JsonArray::const_iterator,
-                                                  JsonArray::iterator>;  ///< 数组迭代器类型。
-
         /**
-         * @brief 构造函数，初始化迭代器。
-         * @param value 指向的 JSON 值（对象、数组或基本类型）。
-         * @param end 是否为结束迭代器（true 表示结束位置，false 表示起始位置）。
+         * @brief 构造构建 DOM 的增量解析器。
+         * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
          */
-        BaseIterator(std::conditional_t<IsConst, const T*, T*> value, bool end = false)
-            : m_value(value) {
-            if (value->isObject()) {
-                m_it = end ? value->m_value.object->end() : value->m_value.object->begin();
-            } else if (value->isArray()) {
-                m_it = end ? value->m_value.array->end() : value->m_value.array->begin();
-            } else {
-                m_it = end ? static_cast<size_t>(1) : 0;
-            }
-        }
+        explicit PushParser(const ParserOptions& options = {});
 
         /**
-         * @brief 解引用操作符，返回当前迭代器指向的值。
-         * @return 当前值的引用。
+         * @brief 构造将事件交给 handler 的增量解析器。
+         * @param handler 事件处理器，必须比解析器活得久。
+         * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
          */
-        reference operator*() const {
-            if (m_value->isObject()) {
-                return std::get<ObjectIterator>(m_it)->second;
-            } else if (m_value->isArray()) {
-                return *std::get<ArrayIterator>(m_it);
-            } else {
-                return *m_value;
-            }
-        }
+        explicit PushParser(JsonHandler& handler, const ParserOptions& options = {});
 
-        /**
-         * @brief 箭头操作符，返回当前迭代器指向值的指针。
-         * @return 指向当前值的指针。
-         */
-        pointer operator->() const {
-            return &this->operator*();
-        }
+        ~PushParser();
+        PushParser(PushParser&&) noexcept;
+        PushParser& operator=(PushParser&&) noexcept;
+        PushParser(const PushParser&)            = delete;
+        PushParser& operator=(const PushParser&) = delete;
 
         /**
-         * @brief 前置递增操作符，移动到下一个元素。
-         * @return 当前迭代器的引用。
+         * @brief 送入下一块输入。
+         * @param chunk 输入块，调用返回后即可释放。
+         * @return handler 要求停止时返回 false。
+         * @exception JsonParseException 如果输入存在语法错误，抛出异常，位置为整个输入中的偏移。
          */
-        BaseIterator& operator++() {
-            if (m_value->isObject()) {
-                ++std::get<ObjectIterator>(m_it);
-            } else if (m_value->isArray()) {
-                ++std::get<ArrayIterator>(m_it);
-            } else {
-                ++std::get<size_t>(m_it);
-            }
-            return *this;
-        }
+        bool feed(std::string_view chunk);
 
         /**
-         * @brief 后置递增操作符，移动到下一个元素并返回原迭代器副本。
-         * @return 原迭代器的副本。
+         * @brief 输入结束：解析最后一个 token 并检查文档是否完整。
+         * @return handler 要求停止时返回 false。
+         * @exception JsonParseException 如果文档不完整或存在语法错误，抛出异常。
          */
-        BaseIterator operator++(int) {
-            BaseIterator tmp = *this;
-            ++(*this);
-            return tmp;
-        }
+        bool finish();
 
         /**
-         * @brief 前置递减操作符，移动到上一个元素。
-         * @return 当前迭代器的引用。
+         * @brief 获取构建的 DOM（finish() 之后有效，SAX 模式下为 null）
+         * @return 根节点的引用。
          */
-        BaseIterator& operator--() {
-            if (m_value->isObject()) {
-                --std::get<ObjectIterator>(m_it);
-            } else if (m_value->isArray()) {
-                --std::get<ArrayIterator>(m_it);
-            } else {
-                --std::get<size_t>(m_it);
-            }
-            return *this;
-        }
+        JsonValue& root() noexcept;
 
-        /**
-         * @brief 后置递减操作符，移动到上一个元素并返回原迭代器副本。
-         * @return 原迭代器的副本。
-         */
-        BaseIterator operator--(int) {
-            BaseIterator tmp = *this;
-            --(*this);
-            return tmp;
-        }
+      private:
+        struct State;
+        std::unique_ptr<State> m_state;  ///< 解析状态
+    };
+}  // namespace parser
+
+namespace parser {
+    /**
+     * @struct NdjsonOptions
+     * @brief NDJSON（JSON Lines）解析配置。
+     */
+    struct NdjsonOptions {
+        ParserOptions parser;               ///< 每条记录的解析配置
+        size_t        threads   = 0;        ///< 工作线程数，0 表示使用硬件线程数
+        bool          ordered   = true;     ///< 是否按顺序回调（false 时回调在工作线程中并发执行）
+        size_t        batchSize = 1 << 18;  ///< 每个任务包含的输入字节数（在换行处截断）
+    };
+
+    /**
+     * @brief NDJSON 记录的回调：参数为记录所在的行号（从 0 开始）和解析结果。
+     * @note NdjsonOptions::ordered 为 false 时，回调会在多个工作线程中同时被调用，
+     *       访问共享状态时需要自行加锁或使用原子变量。
+     */
+    using NdjsonCallback = std::function<void(size_t line, JsonValue&& value)>;
+
+    /**
+     * @brief 并行解析 NDJSON（每行一个 JSON 值）
+     *
+     * 输入按换行切分为若干批，由工作线程池并行解析，空行（只含空白）被跳过。
+     * 合法的 JSON 字符串中不能出现未转义的换行符，因此换行符一定是记录边界。
+     * options.ordered 为 true 时，所有回调都在调用线程中按行号递增的顺序执行；
+     * 为 false 时，回调在工作线程中以任意顺序并发执行，callback 必须是线程安全的。
+     * 遇到错误时停止解析并在调用线程中重新抛出；按顺序回调时，出错行之前的记录都已经回调。
+     * @param input NDJSON 输入。
+     * @param callback 每条记录的回调。
+     * @param options 解析配置。
+     * @return 解析的记录数。
+     * @exception JsonParseException 如果某条记录解析失败，抛出异常，位置为整个输入中的偏移。
+     */
+    size_t parseNdjson(std::string_view      input,
+                       const NdjsonCallback& callback,
+                       const NdjsonOptions&  options = {});
+
+    /**
+     * @brief 从输入流中读取并并行解析 NDJSON。
+     *
+     * 与 parseNdjson(std::string_view, ...) 相同，但输入按块读取，读取与解析同时进行，
+     * 同时驻留在内存中的输入只有正在解析的若干批，适合数 GB 的日志文件。
+     * @param input NDJSON 输入流（建议以二进制模式打开）
+     * @param callback 每条记录的回调。
+     * @param options 解析配置。
+     * @return 解析的记录数。
+     * @exception JsonParseException 如果某条记录解析失败，抛出异常，位置为整个输入中的偏移。
+     * @exception JsonException 如果读取输入流失败，抛出异常。
+     */
+    size_t parseNdjson(std::istream&         input,
+                       const NdjsonCallback& callback,
+                       const NdjsonOptions&  options = {});
+
+    /**
+     * @struct ParallelOptions
+     * @brief 大数组并行解析配置。
+     */
+    struct ParallelOptions {
+        ParserOptions parser;               ///< 解析配置
+        size_t        threads   = 0;        ///< 解析线程数（包括调用线程），0 表示使用硬件线程数
+        std::string   arrayPath;            ///< 要并行解析的数组的 JSON Pointer，空表示根节点
+        size_t        sliceSize = 1 << 16;  ///< 每个任务至少包含的输入字节数（在元素边界处截断）
+    };
+
+    /**
+     * @brief 并行解析以一个巨大数组为主体的 JSON 文档。
+     *
+     * 先跳过式扫描 options.arrayPath 指向的数组（只检查字符串边界和括号层次），
+     * 在元素边界处把它切分为若干片，由多个线程并行解析后按顺序拼接；
+     * 文档的其余部分在调用线程中正常解析。
+     * 结果与 parse(json, options.parser) 完全相同；路径不存在或不是数组时等同于 parse。
+     * 输入有错误时回退到串行解析，抛出的异常（包括位置）也与 parse 相同。
+     * @param json JSON 输入字符串。
+     * @param options 解析配置。
+     * @return 解析结果。
+     * @exception JsonParseException 如果解析失败，抛出异常。
+     * @exception JsonException 如果 options.arrayPath 不是合法的 JSON Pointer，抛出异常。
+     */
+    JsonValue parseParallel(std::string_view json, const ParallelOptions& options = {});
 
+    /**
+     * @class Projection
+     * @brief 投影：parseProjected 需要构建的一组路径。
+     *
+     * 每条路径是一个 JSON Pointer（RFC 6901），其中值为 "*" 的一级引用匹配数组的所有元素
+     * 或对象的所有成员，例如依次由 statuses、*、id 组成的路径选中 statuses 数组中每个元素的 id。
+     * 一条路径是另一条路径的前缀时，以较短的路径为准（整个子树都会被构建）
+     */
+    class Projection {
+      public:
         /**
-         * @brief 比较两个迭代器是否相等。
-         * @param other 另一个迭代器。
-         * @return 如果两个迭代器指向相同位置，返回 true，否则返回 false。
+         * @struct Node
+         * @brief 路径树的节点，对应路径中的一级引用。
          */
-        bool operator==(const BaseIterator& other) const {
-            if (m_value != other.m_value) {
-                return false;
-            }
-            if (m_value->isObject()) {
-                return std::get<ObjectIterator>(m_it) == std::get<ObjectIterator>(other.m_it);
-            } else if (m_value->isArray()) {
-                return std::get<ArrayIterator>(m_it) == std::get<ArrayIterator>(other.m_it);
-            } else {
-                return std::get<size_t>(m_it) == std::get<size_t>(other.m_it);
-            }
-        }
+        struct Node {
+            std::string         token;     ///< 该级引用（已经反转义），根节点为空
+            bool                selected;  ///< 是否选中该节点的整个子树
+            std::vector<size_t> children;  ///< 子节点在 nodes() 中的下标
+        };
 
         /**
-         * @brief 比较两个迭代器是否不相等。
-         * @param other 另一个迭代器。
-         * @return 如果两个迭代器指向不同位置，返回 true，否则返回 false。
+         * @brief 由一组 JSON Pointer 构造投影。
+         * @param paths 路径。
+         * @exception JsonException 如果某条路径不是合法的 JSON Pointer，抛出异常。
          */
-        bool operator!=(const BaseIterator& other) const {
-            return !(this->operator==(other));
-        }
+        Projection(std::initializer_list<std::string_view> paths);
 
-        /**
-         * @brief 获取当前对象迭代器的键（仅适用于对象类型）。
-         * @return 当前键的字符串。
-         * @throws JsonException 如果迭代器不指向对象类型。
+        /**
+         * @brief 由一组 JSON Pointer 构造投影。
+         * @param paths 路径。
+         * @exception JsonException 如果某条路径不是合法的 JSON Pointer，抛出异常。
          */
-        std::string key() const {
-            if (!m_value->isObject()) {
-                throw JsonException("Not an object iterator");
-            }
-            return std::get<ObjectIterator>(m_it)->first;
-        }
+        Projection(const std::vector<std::string>& paths);
 
         /**
-         * @brief 获取当前迭代器的值。
-         * @return 当前值的引用。
+         * @brief 获取路径树，第一个节点为根节点。
+         * @return 路径树的全部节点。
          */
-        reference value() const {
-            return operator*();
+        const std::vector<Node>& nodes() const noexcept {
+            return m_nodes;
         }
 
       private:
-        std::conditional_t<IsConst, const T*, T*> m_value = nullptr;  ///< 指向的 JSON 值。
-        std::variant<ObjectIterator, ArrayIterator, size_t>
-            m_it;  ///< 内部迭代器（对象、数组或基本类型的索引）。
+        /**
+         * @brief 把一条路径加入路径树。
+         * @param path JSON Pointer。
+         */
+        void add(std::string_view path);
+
+        std::vector<Node> m_nodes;  ///< 路径树
     };
 
     /**
-     * @brief 非 const 迭代器类型，用于遍历可修改的 JsonValue。
+     * @brief 只构建投影中的路径，跳过其余的子树。
+     *
+     * 路径上的数组和对象逐个成员检查：不在投影中的成员用括号/引号匹配的扫描器整体跳过，
+     * 不构建任何节点；选中的值与 parse 相同地完整解析。结果中的对象只包含选中的成员，
+     * 数组保持原来的长度，未选中的元素为 null，不存在的路径被忽略。
+     * 对象中的键重复时与 parse 相同，只保留第一次出现的成员：即使第一次出现的值类型与路径
+     * 不符（例如路径还没有结束而值是标量，因而不出现在结果中），后面重复的键也不会被解析。
+     * 被跳过的子树只检查字符串和括号是否完整，其中的其他语法错误不会被报告。
+     * @param json JSON 输入字符串。
+     * @param projection 要构建的路径。
+     * @param options 解析配置（默认禁用扩展，最大嵌套深度为 DEFAULT_MAX_DEPTH）
+     * @return 只包含选中路径的解析结果。
+     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
      */
-    using Iterator = BaseIterator<JsonValue, false>;
+    JsonValue parseProjected(std::string_view     json,
+                             const Projection&    projection,
+                             const ParserOptions& options = {});
+}  // namespace parser
 
-    /**
-     * @brief const 迭代器类型，用于遍历不可修改的 JsonValue。
-     */
-    using ConstIterator = BaseIterator<JsonValue, true>;
+/**
+ * @brief 按需解析：不构建完整的 DOM，只解析实际访问到的值。
+ */
+namespace parser::ondemand {
+    class Value;
 
     /**
-     * @brief 反向迭代器模板类，用于反向遍历 JSON 数据结构。
-     * @tparam ForwardIt 正向迭代器类型。
+     * @class Document
+     * @brief 按需解析的文档。
+     *
+     * 构造时不解析任何内容。通过 operator[] 得到的 Value 只记录值在输入中的位置：
+     * 查找对象成员时逐个比较键，不匹配的成员连同其子树一起跳过而不构建；
+     * 只有调用 get<T>() 时才按 parser::parse 的规则解析并校验该值。
+     * 被跳过的部分只检查字符串边界和括号的层次，需要完整校验时请使用 parser::parse。
+     *
+     * 文档记住最近一次在数组和对象中查找到的位置：按照文档中的顺序访问元素或成员时，
+     * 下一次查找从上一次的位置继续向前，而不是从头开始；乱序访问时回到开头重新查找。
+     * 因此对象中有重复的键时，得到的不一定是第一个（parser::parse 保留第一个）。
+     *
+     * Document 不持有输入，调用者需保证 json 在 Document 及其 Value 的生命周期内有效；
+     * Value 引用 Document，因此 Document 不能拷贝或移动。
      */
-    template <typename ForwardIt>
-    class BaseReverseIterator {
+    class Document {
       public:
-        using value_type = typename ForwardIt::value_type;  ///< 反向迭代器指向的值类型。
-        using reference       = typename ForwardIt::reference;  ///< 值的引用类型。
-        using pointer         = typename ForwardIt::pointer;    ///< 指向值的指针类型。
-        using difference_type = typename ForwardIt::difference_type;  ///< 迭代器差值类型。
-        using iterator_category = std::bidirectional_iterator_tag;  ///< 迭代器类别（双向迭代器）。
+        /**
+         * @brief 构造按需解析的文档。
+         * @param json JSON 输入字符串。
+         * @param options 解析配置，用于访问到的值（最大嵌套深度只作用于 get<T>() 构建的值）
+         * @exception JsonParseException 如果输入为空（只包含空白字符），抛出异常。
+         */
+        explicit Document(std::string_view json, const ParserOptions& options = {});
+
+        Document(const Document&)            = delete;
+        Document& operator=(const Document&) = delete;
 
         /**
-         * @brief 构造函数，初始化反向迭代器。
-         * @param it 正向迭代器，用于初始化反向迭代器。
+         * @brief 获取根节点。
+         * @return 指向根节点的 Value。
          */
-        explicit BaseReverseIterator(ForwardIt it) : m_it(std::move(it)) {}
+        Value root() const;
 
         /**
-         * @brief 解引用操作符，返回当前反向迭代器指向的值。
-         * @return 当前值的引用。
+         * @brief 查找根对象的成员。
+         * @param key 成员的键。
+         * @return 指向成员值的 Value。
+         * @exception JsonException 如果根节点不是对象或键不存在，抛出异常。
+         * @exception JsonParseException 如果查找过程中遇到语法错误，抛出异常。
          */
-        reference operator*() const {
-            auto tmp = m_it;
-            return *--tmp;
-        }
+        Value operator[](std::string_view key) const;
 
         /**
-         * @brief 箭头操作符，返回当前反向迭代器指向值的指针。
-         * @return 指向当前值的指针。
+         * @brief 获取根数组的元素。
+         * @param index 元素下标。
+         * @return 指向元素的 Value。
+         * @exception JsonException 如果根节点不是数组或下标越界，抛出异常。
+         * @exception JsonParseException 如果查找过程中遇到语法错误，抛出异常。
          */
-        pointer operator->() const {
-            auto tmp = m_it;
-            return &*--tmp;
-        }
+        Value operator[](size_t index) const;
+
+      private:
+        friend class Value;
 
         /**
-         * @brief 前置递增操作符，移动到上一个元素（反向遍历）。
-         * @return 当前反向迭代器的引用。
+         * @brief 最近一次查找的位置。
          */
-        BaseReverseIterator& operator++() {
-            --m_it;
-            return *this;
-        }
+        struct Cursor {
+            size_t container = std::string_view::npos;  ///< 数组或对象的起始位置
+            size_t index     = 0;                       ///< 上一次访问的下标（对象：键的位置）
+            size_t position  = 0;                       ///< 上一次访问的元素（对象：值的位置）
+        };
+
+        std::string_view               m_json;     ///< 输入
+        ParserOptions                  m_options;  ///< 解析配置
+        size_t                         m_root;     ///< 根节点的起始位置
+        mutable std::deque<JsonString> m_strings;  ///< 为 get<std::string_view>() 保存的反转义结果
+        mutable Cursor                 m_array;    ///< 最近一次查找的数组
+        mutable Cursor                 m_object;   ///< 最近一次查找的对象
+    };
 
+    /**
+     * @class Value
+     * @brief 指向输入中某个值的游标，本身不解析该值。
+     */
+    class Value {
+      public:
         /**
-         * @brief 后置递增操作符，移动到上一个元素并返回原迭代器副本。
-         * @return 原反向迭代器的副本。
+         * @class ArrayIterator
+         * @brief 依次访问数组元素的前向迭代器，每次前进时跳过当前元素。
          */
-        BaseReverseIterator operator++(int) {
-            BaseReverseIterator tmp = *this;
-            --m_it;
-            return tmp;
-        }
+        class ArrayIterator {
+          public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = Value;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = Value;
+
+            /**
+             * @brief 获取当前元素。
+             * @return 指向当前元素的 Value。
+             */
+            Value operator*() const {
+                return Value(m_document, m_position);
+            }
+
+            /**
+             * @brief 跳过当前元素，前进到下一个元素。
+             * @return 自身的引用。
+             * @exception JsonParseException 如果遇到语法错误，抛出异常。
+             */
+            ArrayIterator& operator++();
+
+            bool operator==(const ArrayIterator& other) const noexcept {
+                return m_position == other.m_position;
+            }
+
+            bool operator!=(const ArrayIterator& other) const noexcept {
+                return m_position != other.m_position;
+            }
+
+          private:
+            friend class Value;
+
+            ArrayIterator(const Document* document, size_t position) noexcept
+                : m_document(document), m_position(position) {}
+
+            const Document* m_document;  ///< 所属文档
+            size_t          m_position;  ///< 当前元素的起始位置，结束时为 npos
+        };
 
         /**
-         * @brief 前置递减操作符，移动到下一个元素（反向遍历）。
-         * @return 当前反向迭代器的引用。
+         * @brief 获取值的类型（数字需要扫描以区分整数和浮点数）
+         * @return 值的类型。
+         * @exception JsonParseException 如果值的第一个字符无效，抛出异常。
          */
-        BaseReverseIterator& operator--() {
-            ++m_it;
-            return *this;
-        }
+        JsonType type() const;
 
         /**
-         * @brief 后置递减操作符，移动到下一个元素并返回原迭代器副本。
-         * @return 原反向迭代器的副本。
+         * @brief 检查是否为 null
+         * @return 如果是 null，返回 true，否则，返回 false
          */
-        BaseReverseIterator operator--(int) {
-            BaseReverseIterator tmp = *this;
-            ++m_it;
-            return tmp;
-        }
+        bool isNull() const;
 
         /**
-         * @brief 比较两个反向迭代器是否相等。
-         * @param other 另一个反向迭代器。
-         * @return 如果两个反向迭代器指向相同位置，返回 true，否则返回 false。
+         * @brief 查找对象的成员，其他成员被跳过而不解析。
+         * @param key 成员的键。
+         * @return 指向成员值的 Value。
+         * @exception JsonException 如果不是对象或键不存在，抛出异常。
+         * @exception JsonParseException 如果查找过程中遇到语法错误，抛出异常。
          */
-        bool operator==(const BaseReverseIterator& other) const {
-            return m_it == other.m_it;
-        }
+        Value operator[](std::string_view key) const;
 
         /**
-         * @brief 比较两个反向迭代器是否不相等。
-         * @param other 另一个反向迭代器。
-         * @return 如果两个反向迭代器指向不同位置，返回 true，否则返回 false。
+         * @brief 获取数组的元素，之前的元素被跳过而不解析。
+         * @param index 元素下标。
+         * @return 指向元素的 Value。
+         * @exception JsonException 如果不是数组或下标越界，抛出异常。
+         * @exception JsonParseException 如果查找过程中遇到语法错误，抛出异常。
          */
-        bool operator!=(const BaseReverseIterator& other) const {
-            return m_it != other.m_it;
-        }
+        Value operator[](size_t index) const;
 
         /**
-         * @brief 获取当前对象反向迭代器的键（仅适用于对象类型）。
-         * @return 当前键的字符串。
-         * @throws JsonException 如果迭代器不指向对象类型。
+         * @brief 获取数组元素或对象成员的个数（需要跳过全部元素）
+         * @return 元素个数。
+         * @exception JsonException 如果既不是数组也不是对象，抛出异常。
          */
-        std::string key() const {
-            auto tmp = m_it;
-            return (--tmp).key();
+        size_t size() const;
+
+        /**
+         * @brief 获取指向数组第一个元素的迭代器。
+         * @exception JsonException 如果不是数组，抛出异常。
+         */
+        ArrayIterator begin() const;
+
+        /**
+         * @brief 获取数组的结束迭代器。
+         */
+        ArrayIterator end() const noexcept {
+            return ArrayIterator(m_document, std::string_view::npos);
         }
 
         /**
-         * @brief 获取当前反向迭代器的值。
-         * @return 当前值的引用。
+         * @brief 解析该值并转换为指定类型。
+         *
+         * std::string_view 直接引用输入（含转义字符时引用文档保存的反转义结果），
+         * JsonValue 得到拥有自己数据的完整子树，其他类型与 JsonValue::get<T>() 相同。
+         * 对根节点调用时与 parser::parse 相同地检查之后只有空白字符。
+         * @param T 目标类型。
+         * @return 指定类型 T 的值。
+         * @exception JsonParseException 如果该值的语法无效，抛出异常。
+         * @exception JsonException 如果类型不匹配，抛出异常。
          */
-        reference value() const {
-            auto tmp = m_it;
-            return (--tmp).value();
+        template <typename T>
+        T get() const {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                return stringView();
+            } else if constexpr (std::is_same_v<T, JsonValue>) {
+                return materialize(false);
+            } else {
+                return materialize(true).template get<T>();
+            }
         }
 
       private:
-        ForwardIt m_it;  ///< 内部正向迭代器。
-    };
-
-    /**
-     * @brief 非 const 反向迭代器类型，用于反向遍历可修改的 JsonValue。
-     */
-    using ReverseIterator = BaseReverseIterator<Iterator>;
-
-    /**
-     * @brief const 反向迭代器类型，用于反向遍历不可修改的 JsonValue。
-     */
-    using ConstReverseIterator = BaseReverseIterator<ConstIterator>;
-
-  public:
-    /**
-     * @brief 获取 JSON 数据结构的正向迭代器（非 const），指向起始位置。
-     * @return Iterator 类型的迭代器，指向 JSON 数据的开头。
-     */
-    Iterator begin() {
-        return {this};
-    }
-
-    /**
-     * @brief 获取 JSON 数据结构的正向迭代器（非 const），指向结束位置。
-     * @return Iterator 类型的迭代器，指向 JSON 数据的末尾。
-     */
-    Iterator end() {
-        return {this, true};
-    }
+        friend class Document;
 
-    /**
-     * @brief 获取 JSON 数据结构的反向迭代器（非 const），指向反向遍历的起始位置（即正向的末尾）。
-     * @return ReverseIterator 类型的反向迭代器，指向 JSON 数据的末尾。
-     */
-    ReverseIterator rbegin() {
-        return ReverseIterator(end());
-    }
-
-    /**
-     * @brief 获取 JSON 数据结构的反向迭代器（非 const），指向反向遍历的结束位置（即正向的开头）。
-     * @return ReverseIterator 类型的反向迭代器，指向 JSON 数据的开头。
-     */
-    ReverseIterator rend() {
-        return ReverseIterator(begin());
-    }
-
-    /**
-     * @brief 获取 JSON 数据结构的正向迭代器（const），指向起始位置。
-     * @return ConstIterator 类型的迭代器，指向 JSON 数据的开头。
-     */
-    ConstIterator begin() const {
-        return {this};
-    }
-
-    /**
-     * @brief 获取 JSON 数据结构的正向迭代器（const），指向结束位置。
-     * @return ConstIterator 类型的迭代器，指向 JSON 数据的末尾。
-     */
-    ConstIterator end() const {
-        return {this, true};
-    }
+        Value(const Document* document, size_t position) noexcept
+            : m_document(document), m_position(position) {}
 
-    /**
-     * @brief 获取 JSON 数据结构的反向迭代器（const），指向反向遍历的起始位置（即正向的末尾）。
-     * @return ConstReverseIterator 类型的反向迭代器，指向 JSON 数据的末尾。
-     */
-    ConstReverseIterator rbegin() const {
-        return ConstReverseIterator(end());
-    }
+        /**
+         * @brief 按 parser::parse 的规则解析该值。
+         * @param borrow 字符串是否引用输入（结果只在内部临时使用时为 true）
+         */
+        JsonValue materialize(bool borrow) const;
 
-    /**
-     * @brief 获取 JSON 数据结构的反向迭代器（const），指向反向遍历的结束位置（即正向的开头）。
-     * @return ConstReverseIterator 类型的反向迭代器，指向 JSON 数据的开头。
-     */
-    ConstReverseIterator rend() const {
-        return ConstReverseIterator(begin());
-    }
+        /**
+         * @brief 获取字符串值的视图。
+         */
+        std::string_view stringView() const;
 
-  private:
-    /**
-     * @brief 释放内部存储的动态内存。
-     */
-    void destroyValue() noexcept;
+        /**
+         * @brief 该值是根节点时，检查之后只有空白字符。
+         * @param position 该值之后的位置。
+         * @exception JsonParseException 如果根节点之后还有其他内容，抛出异常。
+         */
+        void checkEnd(size_t position) const;
 
-  private:
-    JsonType m_type;  ///< JSON 数据类型
-    union
-    {
-        bool        boolean;  ///< 布尔值
-        int64_t     iNumber;  ///< 整数值
-        double      dNumber;  ///< 浮点值
-        JsonString* string;   ///< 字符串指针
-        JsonArray*  array;    ///< 数组指针
-        JsonObject* object;   ///< 对象指针
-    } m_value{};              ///< 存储值的联合体
-};
+        const Document* m_document;  ///< 所属文档
+        size_t          m_position;  ///< 值在输入中的起始位置
+    };
+}  // namespace parser::ondemand
 
 /**
- * @brief JSON 字符串解析和序列化。
+ * @brief 将 JSON 数字文本转换为 double。
  *
- * 提供静态方法用于将 JSON 字符串解析为 JsonValue 对象，以及将 JsonValue 对象序列化为 JSON 字符串。
- * 支持扩展解析选项（如 \\x 和 \\0 转义序列）。
+ * 与解析器使用同一套转换：Eisel–Lemire 算法，结果总是正确舍入的（就近舍入，平局取偶），
+ * 不受 locale 影响。只有有效数字超过 19 位且无法确定舍入方向时才会退回 std::from_chars。
+ * @param str 完整的 JSON 数字，如 "-12.5e3"，前后不能有其他字符
+ * @return 转换后的 double（整数同样按 double 返回）
+ * @exception JsonParseException 如果格式无效或超出 double 的表示范围，抛出异常。
  */
-namespace parser {
-    /**
-     * @enum ParserOption
-     * @brief JSON 解析选项枚举。
-     *
-     * 定义解析 JSON 时的可选配置项，用于控制扩展功能。
-     */
-    enum ParserOption {
-        DISABLE_EXTENSION              = 0,      ///< 禁用所有扩展
-        ENABLE_PARSE_X_ESCAPE_SEQUENCE = 1,      ///< 启用 \x 转义序列解析
-        ENABLE_PARSE_0_ESCAPE_SEQUENCE = 1 << 1  ///< 启用 \0 转义序列解析
-    };
-
-    /**
-     * @brief 从 JSON 字符串解析为 JsonValue。
-     * @param json JSON 输入字符串。
-     * @param option 解析选项（默认禁用扩展）
-     * @return 解析结果的 JsonValue 对象。
-     * @exception JsonParseException 如果解析失败，抛出异常，包含错误信息和位置。
-     */
-    JsonValue parse(std::string_view json, ParserOption option = DISABLE_EXTENSION);
-
-    /**
-     * @brief 将 JsonValue 序列化为 JSON 字符串。
-     * @param value 要序列化的 JSON 值。
-     * @param indent 缩进空格数（默认 0，表示无缩进）
-     * @return 序列化的 JSON 字符串。
-     * @exception JsonException 如果序列化失败（如数值无效），抛出异常。
-     */
-    std::string stringify(const JsonValue& value, int indent = 0);
-}  // namespace parser
+double parseDouble(std::string_view str);
 
 // 容器序列化支持
 
@@ -640,17 +640,23 @@ T deserialize(const ccjson::JsonValue& root) {
 /**
  * @brief 反序列化支持反射的类型。
  *
- * 遍历类型的成员变量并递归从 JSON 反序列化。
+ * 遍历类型的成员变量并递归从 JSON 反序列化；JSON 中不存在的成员保留默认初始化的值。
  * @tparam T 要反序列化的类型（需支持 forEachMemberPtr）。
  * @param root JSON 值。
  * @return 反序列化后的 T 类型对象。
+ * @exception JsonException 如果 root 不是对象或成员类型转换失败，抛出异常。
  */
 template <typename T,
           typename std::enable_if_t<reflect::ReflectTrait<T>::hasForEachMemberPtr(), int> = 0>
 T deserialize(const ccjson::JsonValue& root) {
-    T object;
+    if (!root.isObject()) {
+        throw ccjson::JsonException("Not an Object");
+    }
+    T object{};
     ccjson::reflect::forEachMember(object, [&](const char* key, auto& value) {
-        value = deserialize<std::decay_t<decltype(value)>>(root[key]);
+        if (const ccjson::JsonValue* member = root.find(key)) {
+            value = deserialize<std::decay_t<decltype(value)>>(*member);
+        }
     });
     return object;
 }
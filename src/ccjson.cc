@@ -1,26 +1,99 @@
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "misc-no-recursion"
 #include "ccjson.h"
+#include "ccjson_float.h"
+#include "ccjson_simd.h"
+#include <atomic>
 #include <charconv>
+#include <chrono>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
+#include <random>
 #include <sstream>
+#include <system_error>
+#include <thread>
 
 namespace ccjson {
 
+uint64_t JsonKey::randomSeed() noexcept {
+    uint64_t seed = static_cast<uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    // 地址随机化使同一时刻启动的进程也得到不同的种子
+    seed ^= reinterpret_cast<uintptr_t>(&seed) * 0x9e3779b97f4a7c15ULL;
+    try {
+        std::random_device device;
+        seed ^= static_cast<uint64_t>(device()) << 32 | device();
+    } catch (...) {
+        // 没有随机设备时只使用时钟和地址
+    }
+    // splitmix64 的最终混合，使种子的每一位都依赖所有输入
+    seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+    return seed ^ (seed >> 31);
+}
+
+/// 拷贝和析构嵌套容器时直接递归的最大层数，更深的部分改用显式栈
+static constexpr size_t RECURSION_LIMIT = 128;
+
+/// 当前线程正在递归拷贝或析构的容器层数
+static thread_local size_t t_recursionDepth = 0;
+
+/**
+ * @struct RecursionGuard
+ * @brief 在作用域内把 t_recursionDepth 加一。
+ */
+struct RecursionGuard {
+    RecursionGuard() noexcept {
+        ++t_recursionDepth;
+    }
+
+    ~RecursionGuard() {
+        --t_recursionDepth;
+    }
+
+    RecursionGuard(const RecursionGuard&)            = delete;
+    RecursionGuard& operator=(const RecursionGuard&) = delete;
+};
+
 JsonValue::JsonValue(const JsonValue& other) : m_type(other.m_type) {
     switch (m_type) {
         case JsonType::Null: break;
         case JsonType::Boolean: m_value.boolean = other.m_value.boolean; break;
-        case JsonType::Integer: m_value.iNumber = other.m_value.iNumber; break;
-        case JsonType::Double: m_value.dNumber = other.m_value.dNumber; break;
-        case JsonType::String: m_value.string = new std::string(*other.m_value.string); break;
-        case JsonType::Array: m_value.array = new JsonArray(*other.m_value.array); break;
-        case JsonType::Object: m_value.object = new JsonObject(*other.m_value.object); break;
+        // 保留原始文本的数字同样复制文本
+        case JsonType::Integer:
+        case JsonType::Double:
+            if (other.m_storage == Storage::Heap) {
+                m_value = other.m_value;
+            } else {
+                setNumberText(other.rawNumber());
+            }
+            break;
+        // 引用外部内存的字符串在拷贝时复制内容，副本不依赖外部内存
+        case JsonType::String: setString(other.asStringView()); break;
+        case JsonType::Array:
+            if (t_recursionDepth < RECURSION_LIMIT) {
+                RecursionGuard guard;
+                m_value.array = new JsonArray(*other.m_value.array);
+            } else {
+                copyContainer(other);
+            }
+            break;
+        case JsonType::Object:
+            if (t_recursionDepth < RECURSION_LIMIT) {
+                RecursionGuard guard;
+                m_value.object = new JsonObject(*other.m_value.object);
+            } else {
+                copyContainer(other);
+            }
+            break;
     }
 }
 
-JsonValue::JsonValue(JsonValue&& other) noexcept : m_type(other.m_type) {
+JsonValue::JsonValue(JsonValue&& other) noexcept
+    : m_type(other.m_type), m_storage(other.m_storage), m_length(other.m_length) {
+    m_small[0]           = other.m_small[0];
+    m_small[1]           = other.m_small[1];
     m_value              = other.m_value;
     other.m_type         = JsonType::Null;
     other.m_value.object = nullptr;
@@ -28,17 +101,7 @@ JsonValue::JsonValue(JsonValue&& other) noexcept : m_type(other.m_type) {
 
 JsonValue& JsonValue::operator=(const JsonValue& other) {
     if (this != &other) {
-        destroyValue();
-        m_type = other.m_type;
-        switch (m_type) {
-            case JsonType::Null: break;
-            case JsonType::Boolean: m_value.boolean = other.m_value.boolean; break;
-            case JsonType::Integer: m_value.iNumber = other.m_value.iNumber; break;
-            case JsonType::Double: m_value.dNumber = other.m_value.dNumber; break;
-            case JsonType::String: m_value.string = new std::string(*other.m_value.string); break;
-            case JsonType::Array: m_value.array = new JsonArray(*other.m_value.array); break;
-            case JsonType::Object: m_value.object = new JsonObject(*other.m_value.object); break;
-        }
+        *this = JsonValue(other);
     }
     return *this;
 }
@@ -47,6 +110,10 @@ JsonValue& JsonValue::operator=(JsonValue&& other) noexcept {
     if (this != &other) {
         destroyValue();
         m_type               = other.m_type;
+        m_storage            = other.m_storage;
+        m_small[0]           = other.m_small[0];
+        m_small[1]           = other.m_small[1];
+        m_length             = other.m_length;
         m_value              = other.m_value;
         other.m_type         = JsonType::Null;
         other.m_value.object = nullptr;
@@ -58,7 +125,7 @@ JsonValue::~JsonValue() {
     destroyValue();
 }
 
-JsonValue& JsonValue::set(const std::string& key, const JsonValue& value) {
+JsonValue& JsonValue::set(std::string_view key, const JsonValue& value) {
     if (m_type != JsonType::Object) {
         destroyValue();
         m_type         = JsonType::Object;
@@ -90,9 +157,9 @@ JsonValue::operator int16_t() const {
         throw JsonException("Cannot convert to int16_t");
     }
     if (m_type == JsonType::Integer) {
-        return static_cast<int16_t>(m_value.iNumber);
+        return static_cast<int16_t>(integerValue());
     }
-    return static_cast<int16_t>(m_value.dNumber);
+    return static_cast<int16_t>(doubleValue());
 }
 
 JsonValue::operator int32_t() const {
@@ -100,9 +167,9 @@ JsonValue::operator int32_t() const {
         throw JsonException("Cannot convert to int32_t");
     }
     if (m_type == JsonType::Integer) {
-        return static_cast<int32_t>(m_value.iNumber);
+        return static_cast<int32_t>(integerValue());
     }
-    return static_cast<int32_t>(m_value.dNumber);
+    return static_cast<int32_t>(doubleValue());
 }
 
 JsonValue::operator int64_t() const {
@@ -110,9 +177,9 @@ JsonValue::operator int64_t() const {
         throw JsonException("Cannot convert to int64_t");
     }
     if (m_type == JsonType::Integer) {
-        return m_value.iNumber;
+        return integerValue();
     }
-    return static_cast<int64_t>(m_value.dNumber);
+    return static_cast<int64_t>(doubleValue());
 }
 
 JsonValue::operator float() const {
@@ -120,9 +187,9 @@ JsonValue::operator float() const {
         throw JsonException("Cannot convert to float");
     }
     if (m_type == JsonType::Double) {
-        return static_cast<float>(m_value.dNumber);
+        return static_cast<float>(doubleValue());
     }
-    return static_cast<float>(m_value.iNumber);
+    return static_cast<float>(integerValue());
 }
 
 JsonValue::operator double() const {
@@ -130,82 +197,384 @@ JsonValue::operator double() const {
         throw JsonException("Cannot convert to double");
     }
     if (m_type == JsonType::Double) {
-        return m_value.dNumber;
+        return doubleValue();
     }
-    return static_cast<double>(m_value.iNumber);
+    return static_cast<double>(integerValue());
 }
 
 JsonValue::operator std::string() const {
     if (!isString()) {
         throw JsonException("Cannot convert to string");
     }
-    return *m_value.string;
+    return std::string(asStringView());
+}
+
+void JsonValue::setString(std::string_view value) {
+    if (value.size() <= INLINE_STRING_CAPACITY) {
+        std::memcpy(inlineString(), value.data(), value.size());
+        m_storage = static_cast<Storage>(static_cast<uint8_t>(Storage::InlineString) | value.size());
+    } else {
+        m_value.string = new JsonString(value);
+        m_storage      = Storage::Heap;
+    }
+}
+
+JsonString& JsonValue::ownString() const {
+    // 值内部的短字符串与 m_value 重叠，必须先复制出来
+    auto* string   = new JsonString(asStringView());
+    m_value.string = string;
+    m_storage      = Storage::Heap;
+    m_length       = 0;
+    return *string;
+}
+
+void JsonValue::setNumberText(std::string_view text) {
+    if (text.size() <= INLINE_STRING_CAPACITY) {
+        std::memcpy(inlineString(), text.data(), text.size());
+        m_storage = static_cast<Storage>(static_cast<uint8_t>(Storage::InlineString) | text.size());
+    } else {
+        auto* data = new char[text.size()];
+        std::memcpy(data, text.data(), text.size());
+        m_value.view = data;
+        m_storage    = Storage::HeapText;
+        m_length     = static_cast<uint32_t>(text.size());
+    }
+}
+
+int64_t JsonValue::textToInteger() const noexcept {
+    std::string_view text     = rawNumber();
+    bool             negative = text[0] == '-';
+    uint64_t         value    = 0;
+    for (size_t i = negative ? 1 : 0; i < text.size(); ++i) {
+        value = value * 10 + static_cast<uint64_t>(text[i] - '0');
+    }
+    return negative ? static_cast<int64_t>(0 - value) : static_cast<int64_t>(value);
 }
 
 std::string JsonValue::toString(int indent) const {
     return parser::stringify(*this, indent);
 }
 
+/**
+ * @brief 判断值是否为数组或对象。
+ * @param value JSON 值。
+ * @return 数组或对象返回 true。
+ */
+static inline bool isContainer(const JsonValue& value) noexcept {
+    return value.isArray() || value.isObject();
+}
+
+/**
+ * @brief 把数组或对象中作为子节点的数组/对象移动到 pending 中，容器析构时不再向下递归。
+ * @param value 数组或对象。
+ * @param pending 待销毁的容器（输入输出参数）
+ */
+static void detachContainers(JsonValue& value, std::vector<JsonValue>& pending) {
+    if (value.isArray()) {
+        for (auto& element : value.asArray()) {
+            if (isContainer(element)) {
+                pending.push_back(std::move(element));
+            }
+        }
+    } else {
+        for (auto& member : value.asObject()) {
+            if (isContainer(member.second)) {
+                pending.push_back(std::move(member.second));
+            }
+        }
+    }
+}
+
+void JsonValue::copyContainer(const JsonValue& other) {
+    m_type = JsonType::Null;
+    // 每一项是一个已经放入父容器的空值，以及它要拷贝的数组或对象
+    std::vector<std::pair<JsonValue*, const JsonValue*>> pending{{this, &other}};
+    try {
+        while (!pending.empty()) {
+            auto [target, source] = pending.back();
+            pending.pop_back();
+            if (source->isArray()) {
+                const auto& from = source->asArray();
+                target->m_value.array = new JsonArray();
+                target->m_type        = JsonType::Array;
+                auto& array           = *target->m_value.array;
+                // 预留空间后元素地址不再变化，可以记录在 pending 中
+                array.reserve(from.size());
+                for (const auto& element : from) {
+                    if (isContainer(element)) {
+                        pending.emplace_back(&array.emplace_back(), &element);
+                    } else {
+                        array.push_back(element);
+                    }
+                }
+            } else {
+                const auto& from       = source->asObject();
+                target->m_value.object = new JsonObject();
+                target->m_type         = JsonType::Object;
+                auto& object           = *target->m_value.object;
+                object.reserve(from.size());
+                for (const auto& [key, value] : from) {
+                    if (!isContainer(value)) {
+                        object.try_emplace(key, value);
+                    } else if (auto [member, inserted] = object.try_emplace(key); inserted) {
+                        pending.emplace_back(&member->second, &value);
+                    }
+                }
+            }
+        }
+    } catch (...) {
+        // 已经拷贝的部分是一棵完整的树，直接销毁
+        destroyValue();
+        m_type = JsonType::Null;
+        throw;
+    }
+}
+
 void JsonValue::destroyValue() noexcept {
     switch (m_type) {
         // 动态分配的内存
-        case JsonType::String: delete m_value.string; break;
-        case JsonType::Array: delete m_value.array; break;
-        case JsonType::Object: delete m_value.object; break;
+        case JsonType::String:
+            if (m_storage == Storage::Heap) {
+                delete m_value.string;
+            }
+            break;
+        case JsonType::Integer:
+        case JsonType::Double:
+            if (m_storage == Storage::HeapText) {
+                delete[] m_value.view;
+            }
+            break;
+        case JsonType::Array:
+        case JsonType::Object: {
+            if (t_recursionDepth >= RECURSION_LIMIT) {
+                // 嵌套的容器逐层移出后再析构，此后每个容器析构时子节点中都不再有容器
+                std::vector<JsonValue> pending;
+                detachContainers(*this, pending);
+                while (!pending.empty()) {
+                    JsonValue value = std::move(pending.back());
+                    pending.pop_back();
+                    detachContainers(value, pending);
+                }
+            }
+            RecursionGuard guard;
+            if (m_type == JsonType::Object) {
+                if (m_storage == Storage::Arena) {
+                    std::destroy_at(m_value.object);
+                } else {
+                    delete m_value.object;
+                }
+            } else if (m_storage == Storage::Arena) {
+                std::destroy_at(m_value.array);
+            } else {
+                delete m_value.array;
+            }
+            break;
+        }
         default: break;
     }
+    m_storage = Storage::Heap;
+    m_length  = 0;
 }
 
 /**
  * @brief 跳过json的无用字符串。
- * @param str 输入 JSON 字符串。
+ * @param json 输入 JSON 字符串。
  * @param position 当前解析位置（输入输出参数）
- * @note 不可使用std::isspace,json规范中定义的ws只可为空格,\\t,\\n,\\r
+ * @note 连续的缩进由 simd::skipWhitespace 按块跳过，见 ccjson_simd.h
+ */
+static inline void skipUselessChar(const std::string_view& json, size_t& position) {
+    position = simd::skipWhitespace(json.data(), json.size(), position);
+}
+
+/**
+ * @brief 判断字符是否为十进制数字。
+ * @param c 待判断的字符。
+ * @return 如果是 '0' ~ '9'，返回 true。
+ * @note 不使用 std::isdigit，避免 locale 查表以及负值 char 的未定义行为
+ */
+static inline bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+std::string ParseError::message() const {
+    switch (code) {
+        case ParseErrorCode::None: return "No error";
+        case ParseErrorCode::UnexpectedEndOfInput: return "Unexpected end of input";
+        case ParseErrorCode::UnexpectedEndOfArray: return "Unexpected end of Array";
+        case ParseErrorCode::UnexpectedEndOfObject: return "Unexpected end of Object";
+        case ParseErrorCode::UnexpectedEndOfString: return "Unexpected end of string";
+        case ParseErrorCode::UnexpectedCharacter:
+            return "Unexpected character: " + std::string(1, character);
+        case ParseErrorCode::UnexpectedContent: return "Unexpected content after JSON value";
+        case ParseErrorCode::ExpectedNull: return "Expected 'null'";
+        case ParseErrorCode::ExpectedBoolean: return "Expected 'true' or 'false'";
+        case ParseErrorCode::ExpectedArraySeparator: return "Expected ',' or ']'";
+        case ParseErrorCode::ExpectedObjectSeparator: return "Expected ',' or '}'";
+        case ParseErrorCode::KeyNotString: return "the key of object must be a string";
+        case ParseErrorCode::MaxDepthExceeded: return "Maximum nesting depth exceeded";
+        case ParseErrorCode::SignBeforePoint:
+            return "Invalid numeric format: sign ('+'/'-') cannot be immediately followed by '.'";
+        case ParseErrorCode::LeadingZero: return "Leading zeros are not allowed";
+        case ParseErrorCode::MissingFraction:
+            return "Invalid number format, decimal heed at least 1 number";
+        case ParseErrorCode::MissingExponent:
+            return "Invalid number format, exponent need at least 1 number";
+        case ParseErrorCode::InvalidInteger:
+            return "Invalid argument: The input is not a valid integer number.";
+        case ParseErrorCode::InvalidFloat:
+            return "Invalid argument: The input is not a valid float number.";
+        case ParseErrorCode::NumberOutOfRange:
+            return "Result out of range: The parsed value is too large or too small.";
+        case ParseErrorCode::ControlCharacter:
+            return "Control character not allowed in JSON string";
+        case ParseErrorCode::InvalidEscape: return "Invalid escape sequence";
+        case ParseErrorCode::InvalidUnicodeEscape: return "Invalid unicode escape sequence";
+        case ParseErrorCode::MissingLowSurrogate: return "Missing low surrogate in UTF-16 pair";
+        case ParseErrorCode::InvalidLowSurrogate: return "Invalid low surrogate in \\u escape";
+        case ParseErrorCode::InvalidCodePoint: return "Invalid Unicode code point";
+        case ParseErrorCode::XEscapeDisabled: return "not support parse x escape sequence";
+        case ParseErrorCode::InvalidXEscape: return "Invalid \\x escape sequence";
+        case ParseErrorCode::InvalidXEscapeSize: return "Invalid \\x escape sequence size";
+        case ParseErrorCode::InvalidXEscapeUtf8: return "Invalid UTF-8 sequence";
+        case ParseErrorCode::InvalidZeroEscape: return "Invalid \\0 escape sequence";
+        case ParseErrorCode::InvalidUtf8: return "Invalid UTF-8 sequence";
+    }
+    return "Unknown error";
+}
+
+/**
+ * @brief 记录解析错误。
+ * @param error 解析错误（输出参数）
+ * @param code 错误类型。
+ * @param offset 出错的字符位置。
+ * @return 总是返回 false，便于在解析函数中直接返回。
  */
-#define SKIP_USELESS_CHAR(str, position)                                                           \
-    do {                                                                                           \
-        while (position < str.size() && ((str[position]) == ' ' || (str[position]) == '\t' ||      \
-                                         (str[position]) == '\n' || (str[position]) == '\r')) {    \
-            ++position;                                                                            \
-        }                                                                                          \
-    } while (false)
+static inline bool fail(ParseError& error, ParseErrorCode code, size_t offset) noexcept {
+    error.code   = code;
+    error.offset = offset;
+    return false;
+}
+
+/**
+ * @brief 以 JsonParseException 的形式抛出解析错误（供抛出异常的接口使用）
+ * @param error 解析错误。
+ */
+[[noreturn]] static void throwParseError(const ParseError& error) {
+    throw JsonParseException(error.message(), error.offset);
+}
+
+/**
+ * @struct DomStorage
+ * @brief 构建 DOM 时使用的存储（均可以为空）
+ */
+struct DomStorage {
+    StringPool*                pool  = nullptr;  ///< 键和短字符串值使用的字符串池（parseInterned）
+    std::pmr::memory_resource* arena = nullptr;  ///< 容器和反转义字符串使用的 arena（ENABLE_ARENA）
+};
 
 /**
  * @brief 解析 JSON 值的辅助函数。
+ *
+ * 使用显式的容器栈代替递归，嵌套深度不受调用栈大小的限制。
+ * 与下面的各个解析函数一样，解析错误不抛出异常，而是记录在 error 中并返回 false，
+ * 由调用者决定如何报告（parse 抛出 JsonParseException，tryParse 直接返回）
  * @param json 输入 JSON 字符串。
  * @param position 当前解析位置（输入输出参数）
  * @param option 解析选项。
- * @return 解析后的 JSON 值。
- * @exception JsonParseException 如果解析失败，抛异常出异常。
+ * @param maxDepth 数组/对象的最大嵌套深度，0 表示不限制
+ * @param result 解析后的 JSON 值（输出参数）
+ * @param error 解析错误（输出参数）
+ * @param storage 构建 DOM 时使用的字符串池和 arena。
+ * @return 解析成功返回 true；解析失败或嵌套过深返回 false。
  */
-static JsonValue parseValue(const std::string_view& json, size_t& position, uint8_t option);
+static bool parseValue(const std::string_view& json,
+                       size_t&                 position,
+                       uint8_t                 option,
+                       size_t                  maxDepth,
+                       JsonValue&              result,
+                       ParseError&             error,
+                       DomStorage              storage = {});
 
 /**
  * @brief 解析空值（null）
  * @param json 输入 JSON 字符串。
  * @param position 当前解析位置（输入输出参数）
- * @return 表示空值的 JsonValue。
- * @exception JsonParseException 如果解析失败，抛出异常。
+ * @param error 解析错误（输出参数）
+ * @return 解析成功返回 true。
  */
-static JsonValue parseNull(const std::string_view& json, size_t& position);
+static bool parseNull(const std::string_view& json, size_t& position, ParseError& error);
 
 /**
  * @brief 解析布尔值（true 或 false）
  * @param json 输入 JSON 字符串。
  * @param position 当前解析位置（输入输出参数）
- * @return 表示布尔值的 JsonValue。
- * @exception JsonParseException 如果解析失败，抛出异常。
+ * @param value 解析得到的布尔值（输出参数）
+ * @param error 解析错误（输出参数）
+ * @return 解析成功返回 true。
  */
-static JsonValue parseBoolean(const std::string_view& json, size_t& position);
+static bool parseBoolean(const std::string_view& json,
+                         size_t&                 position,
+                         bool&                   value,
+                         ParseError&             error);
 
 /**
- * @brief 解析数值（整数或浮点数）
+ * @struct NumberText
+ * @brief 扫描数字得到的中间结果。
+ */
+struct NumberText {
+    fp::Decimal decimal;    ///< 十进制尾数与指数
+    size_t      digits;     ///< 整数部分的位数
+    bool        isInteger;  ///< 没有小数部分和指数部分
+};
+
+/**
+ * @brief 扫描并校验一个数字，拆分出十进制尾数与指数，不做转换。
  * @param json 输入 JSON 字符串。
  * @param position 当前解析位置（输入输出参数）
- * @return 表示数值的 JsonValue。
- * @exception JsonParseException 如果数值格式无效，抛出异常。
+ * @param number 扫描结果。
+ * @param error 解析错误（输出参数）
+ * @return 数值格式有效时返回 true。
+ */
+static bool scanNumber(const std::string_view& json,
+                       size_t&                 position,
+                       NumberText&             number,
+                       ParseError&             error);
+
+/**
+ * @brief 将扫描得到的数字转换为 double。
+ * @param json 输入 JSON 字符串。
+ * @param start 数字的起始位置。
+ * @param end 数字的结束位置。
+ * @param number 扫描结果。
+ * @param value 转换后的 double（输出参数）
+ * @param error 解析错误（输出参数）
+ * @return 转换成功返回 true；没有整数部分或超出 double 的表示范围时返回 false。
+ */
+static bool numberToDouble(const std::string_view& json, size_t start, size_t end,
+                           const NumberText& number, double& value, ParseError& error);
+
+/**
+ * @brief 扫描结果为整数且在 int64_t 范围内时，取出其值。
+ * @param number 扫描结果。
+ * @param value 整数值（输出参数）
+ * @return 可以表示为 int64_t 时返回 true。
+ */
+static bool numberToInteger(const NumberText& number, int64_t& value);
+
+/**
+ * @brief 将扫描得到的数字构造为 JsonValue（整数或浮点数）
+ * @param json 输入 JSON 字符串。
+ * @param start 数字的起始位置。
+ * @param end 数字的结束位置。
+ * @param number 扫描结果。
+ * @param option 解析选项（ENABLE_LAZY_NUMBER 时只保留原始文本）
+ * @param value 表示数值的 JsonValue（输出参数）
+ * @param error 解析错误（输出参数）
+ * @return 转换成功返回 true；超出 double 的表示范围时返回 false。
  */
-static JsonValue parseNumber(const std::string_view& json, size_t& position);
+static bool numberToValue(const std::string_view& json, size_t start, size_t end,
+                          const NumberText& number, uint8_t option, JsonValue& value,
+                          ParseError& error);
 
 /**
  * @brief 将hex字符串转为char32_t
@@ -215,184 +584,377 @@ static JsonValue parseNumber(const std::string_view& json, size_t& position);
 static std::pair<char32_t, bool> hexToChar32t(const std::string_view& hex);
 
 /**
- * @brief 将Unicode码点转换为UTF-8字符串。
+ * @brief 将Unicode码点按UTF-8编码追加到输出中。
+ * @tparam Output 输出类型：JsonString 或 InSituOutput
  * @param codePoint unicode码点。
- * @param position 当前解析到的json字符串位置。
- * @return 解析后的unicode字符串
- * @throw JsonParseException 如果码点大于0x10FFFF，抛出异常。
+ * @param result 输出（追加编码后的字符）
+ * @return 码点有效时返回 true；码点大于0x10FFFF时返回 false。
  */
-static std::string parseUnicodeString(char32_t codePoint, size_t position);
+template <typename Output>
+static bool parseUnicodeString(char32_t codePoint, Output& result);
 
 /**
- * @brief 解析字符串。
- * @param json 输入 JSON 字符串。
- * @param position 当前解析位置（输入输出参数）
- * @param option 解析选项。
- * @return 表示字符串的 JsonValue。
- * @throw JsonParseException 如果字符串格式无效，抛出异常。
+ * @brief 内部解析选项：没有转义字符的字符串和键直接引用输入缓冲区，不复制（parseDocument 使用）
+ * @note 占用 ParserOption 中未使用的最高位
  */
-static JsonValue parseString(const std::string_view& json, size_t& position, uint8_t option);
+static constexpr uint8_t BORROW_STRINGS = 1 << 7;
 
 /**
- * @brief 解析数组。
- * @param json 输入 JSON 字符串。
- * @param position 当前解析位置（输入输出参数）
- * @param option 解析选项。
- * @return 表示数组的 JsonValue。
- * @exception JsonParseException 如果数组格式无效，抛出异常。
+ * @brief 内部解析选项：含转义字符的字符串在输入缓冲区中原地反转义（parseInSitu 使用）
+ * @note 设置该选项时输入必须指向可写的内存
+ */
+static constexpr uint8_t IN_SITU = 1 << 6;
+
+/**
+ * @brief 内部解析选项：含转义字符的字符串只校验，不保存反转义结果（validate 使用）
+ */
+static constexpr uint8_t DISCARD_STRINGS = 1 << 5;
+
+/**
+ * @enum StringScan
+ * @brief scanString 的结果。
  */
-static JsonValue parseArray(const std::string_view& json, size_t& position, uint8_t option);
+enum class StringScan : uint8_t {
+    Failed,    ///< 字符串格式无效，错误记录在 error 中
+    Raw,       ///< 结果可以用 raw 表示（不含转义字符、已经原地反转义，或者 DISCARD_STRINGS）
+    Unescaped  ///< 反转义后的结果保存在 result 中
+};
 
 /**
- * @brief 解析对象。
+ * @brief 扫描字符串并处理转义字符。
  * @param json 输入 JSON 字符串。
  * @param position 当前解析位置（输入输出参数）
  * @param option 解析选项。
- * @return 表示对象的 JsonValue。
- * @exception JsonParseException 如果对象格式无效，抛出异常。
+ * @param result 含有转义字符时，反转义后的内容（输出参数，调用前应为空）
+ * @param raw 字符串内容在 json 中的片段（输出参数）
+ * @param error 解析错误（输出参数）
+ * @return 扫描结果，为 StringScan::Raw 时 result 不会被修改。
  */
-static JsonValue parseObject(const std::string_view& json, size_t& position, uint8_t option);
-
-JsonValue parseValue(const std::string_view& json, size_t& position, uint8_t option) {
-    // 跳过无用字符
-    SKIP_USELESS_CHAR(json, position);
-    // 范围检测
-    if (position >= json.size()) {
-        throw JsonParseException("Unexpected end of input", position);
-    }
-    // 根据第一个字符判断接来要解析什么
-    char c = json[position];
-    switch (c) {
-        case 'n': return parseNull(json, position);
-        case 't':
-        case 'f': return parseBoolean(json, position);
-        case '"': return parseString(json, position, option);
-        case '[': return parseArray(json, position, option);
-        case '{': return parseObject(json, position, option);
-        case '-':
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9': return parseNumber(json, position);
-        default: throw JsonParseException("Unexpected character: " + std::string(c, 1), position);
-    }
-}
-
-JsonValue parseNull(const std::string_view& json, size_t& position) {
+static StringScan scanString(const std::string_view& json,
+                             size_t&                 position,
+                             uint8_t                 option,
+                             JsonString&             result,
+                             std::string_view&       raw,
+                             ParseError&             error);
+
+bool parseNull(const std::string_view& json, size_t& position, ParseError& error) {
     // 当前字符一定为n
     // json[pos] - json[pos + 3]
     if (json.substr(position, 4) != "null") {
-        throw JsonParseException("Expected 'null'", position);
+        return fail(error, ParseErrorCode::ExpectedNull, position);
     }
     position += 4;
-    return nullptr;
+    return true;
 }
 
-JsonValue parseBoolean(const std::string_view& json, size_t& position) {
+bool parseBoolean(const std::string_view& json, size_t& position, bool& value, ParseError& error) {
     // 当前字符一定为t或f
     if (json.substr(position, 4) == "true") {
         position += 4;
+        value = true;
         return true;
     } else if (json.substr(position, 5) == "false") {
         position += 5;
-        return false;
+        value = false;
+        return true;
+    }
+    return fail(error, ParseErrorCode::ExpectedBoolean, position);
+}
+
+/**
+ * @brief 从 data[position] 开始累加连续的十进制数字。
+ * @return 数字的个数；超过 19 位时 value 会回绕，由调用者处理
+ */
+static inline size_t accumulateDigits(const char* data, size_t size, size_t& position,
+                                      uint64_t& value) {
+    const size_t first = position;
+    // 一次处理 8 位数字
+    while (position + 8 <= size) {
+        const uint64_t chunk = simd::loadLittleEndian64(data + position);
+        if (!simd::isEightDigits(chunk)) {
+            break;
+        }
+        value = value * 100000000 + simd::parseEightDigits(chunk);
+        position += 8;
+    }
+    while (position < size && isDigit(data[position])) {
+        value = value * 10 + static_cast<uint64_t>(data[position] - '0');
+        position++;
     }
-    throw JsonParseException("Expected 'true' or 'false'", position);
+    return position - first;
 }
 
-JsonValue parseNumber(const std::string_view& json, size_t& position) {
+bool scanNumber(const std::string_view& json,
+                size_t&                 position,
+                NumberText&             number,
+                ParseError&             error) {
     // 解析数字,数字格式为-?(0|[1-9]\d*)(\.\d+)?([eE][+-]?\d+)?
-    size_t start = position;
+    // 校验与尾数的累加在同一遍扫描中完成，直接在输入上进行，不产生临时字符串
+    const char*  data     = json.data();
+    const size_t size     = json.size();
+    uint64_t     mantissa = 0;
+    int64_t      exponent = 0;
+    bool         negative = false;
     // 假设是整数，除非发现小数点或指数
-    bool isInteger = true;
+    number.isInteger = true;
 
     // 处理正负号
-    if (json[position] == '+' || json[position] == '-') {
+    if (data[position] == '+' || data[position] == '-') {
+        negative = data[position] == '-';
         ++position;
-        if (position < json.size() && json[position] == '.') {
-            throw JsonParseException(
-                "Invalid numeric format: sign ('+'/'-') cannot be immediately followed by '.'",
-                position);
+        if (position < size && data[position] == '.') {
+            return fail(error, ParseErrorCode::SignBeforePoint, position);
         }
     }
-    // 处理整数部分（不跳过前导零，仅检查合法性）
-    if (json[position] == '0') {
+    // 处理整数部分（不跳过前导零，仅检查合法性），同时累加尾数
+    const size_t integerStart = position;
+    if (position < size && data[position] == '0') {
         position++;
         // 禁止前导零后跟其他数字（如 "012"）
-        if (position < json.size() && std::isdigit(json[position])) {
-            throw JsonParseException("Leading zeros are not allowed", position);
+        if (position < size && isDigit(data[position])) {
+            return fail(error, ParseErrorCode::LeadingZero, position);
         }
     } else {
-        while (position < json.size() && std::isdigit(json[position])) {
-            position++;
-        }
+        accumulateDigits(data, size, position, mantissa);
     }
+    const size_t integerEnd = position;
+    number.digits           = integerEnd - integerStart;
     // 处理小数
-    if (position < json.size() && json[position] == '.') {
-        isInteger = false;
+    size_t fractionStart = position, fractionEnd = position;
+    if (position < size && data[position] == '.') {
+        number.isInteger = false;
         position++;
         // . 后跟至少一个数字（如 .5 或 3.14）
-        if (position >= json.size() || !std::isdigit(json[position])) {
-            throw JsonParseException("Invalid number format, decimal heed at least 1 number",
-                                     position);
-        }
-        // 跳过数字
-        while (position < json.size() && std::isdigit(json[position])) {
-            position++;
+        if (position >= size || !isDigit(data[position])) {
+            return fail(error, ParseErrorCode::MissingFraction, position);
         }
+        fractionStart = position;
+        exponent      = -static_cast<int64_t>(accumulateDigits(data, size, position, mantissa));
+        fractionEnd   = position;
     }
     // 处理指数
-    if (position < json.size() && (json[position] == 'e' || json[position] == 'E')) {
-        isInteger = false;
+    if (position < size && (data[position] == 'e' || data[position] == 'E')) {
+        number.isInteger = false;
         // e 或 E 后跟可选符号（+/-）和至少一个数字（如 1e3 或 2E-5）
         // 处理符号e
         position++;
         // 处理符号+-
-        if (json[position] == '+' || json[position] == '-') {
+        bool negativeExponent = false;
+        if (position < size && (data[position] == '+' || data[position] == '-')) {
+            negativeExponent = data[position] == '-';
             position++;
         }
         // 处理数字
-        if (position >= json.size() || !std::isdigit(json[position])) {
-            throw JsonParseException("Invalid number format, exponent need at least 1 number",
-                                     position);
+        if (position >= size || !isDigit(data[position])) {
+            return fail(error, ParseErrorCode::MissingExponent, position);
         }
-        while (position < json.size() && std::isdigit(json[position])) {
+        int64_t exponentNumber = 0;
+        while (position < size && isDigit(data[position])) {
+            // 指数过大时结果必然为 0 或 inf，无需继续累加
+            if (exponentNumber < 0x10000000) {
+                exponentNumber = exponentNumber * 10 + (data[position] - '0');
+            }
             position++;
         }
+        exponent += negativeExponent ? -exponentNumber : exponentNumber;
     }
-    std::string raw(json.substr(start, position - start));
-    // 将数值转换为数字
-    if (isInteger) {
-        int64_t result = 0;
-        auto [ptr, ec] = std::from_chars(raw.data(), raw.data() + raw.size(), result);
-        if (ec != std::errc() || ptr != raw.data() + raw.size()) {
-            if (ec == std::errc::result_out_of_range) {
-                goto parseDouble;
+    // 有效数字超过 19 位时，mantissa 已经回绕，只保留前 19 位重新累加
+    bool   truncated = false;
+    size_t count     = (integerEnd - integerStart) + (fractionEnd - fractionStart);
+    if (count > 19) {
+        // 前导零不是有效数字（如 0.000123）
+        for (size_t i = integerStart; i < fractionEnd && count > 0; ++i) {
+            if (data[i] == '0') {
+                --count;
+            } else if (data[i] != '.') {
+                break;
             }
-            throw JsonParseException("Invalid argument: The input is not a valid integer number.",
-                                     start);
         }
-        return result;
-    } else {
-    parseDouble:
-        double result  = 0;
-        auto [ptr, ec] = std::from_chars(raw.data(), raw.data() + raw.size(), result);
-        if (ec != std::errc() || ptr != raw.data() + raw.size()) {
-            if (ec == std::errc::result_out_of_range) {
-                throw JsonParseException(
-                    "Result out of range: The parsed value is too large or too small.", start);
+    }
+    if (count > 19) {
+        constexpr uint64_t minNineteenDigits = 1000000000000000000ULL;
+        truncated                            = true;
+        mantissa                             = 0;
+        size_t i                             = integerStart;
+        while (mantissa < minNineteenDigits && i < integerEnd) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(data[i++] - '0');
+        }
+        if (mantissa >= minNineteenDigits) {
+            // 整数部分剩余的位数作为指数
+            exponent += static_cast<int64_t>(fractionEnd - fractionStart) +
+                        static_cast<int64_t>(integerEnd - i);
+        } else {
+            i = fractionStart;
+            while (mantissa < minNineteenDigits && i < fractionEnd) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(data[i++] - '0');
             }
-            throw JsonParseException("Invalid argument: The input is not a valid float number.",
-                                     start);
+            exponent += static_cast<int64_t>(fractionEnd - i);
+        }
+    }
+    number.decimal = {mantissa, exponent, negative, truncated};
+    return true;
+}
+
+bool numberToDouble(const std::string_view& json, size_t start, size_t end,
+                    const NumberText& number, double& value, ParseError& error) {
+    if (number.digits == 0) {
+        // 没有整数部分（如 "-" 或 "-e5"）
+        const auto code =
+            number.isInteger ? ParseErrorCode::InvalidInteger : ParseErrorCode::InvalidFloat;
+        return fail(error, code, start);
+    }
+    value = fp::toDouble(number.decimal, json.data() + start, json.data() + end);
+    if (std::isinf(value) || (value == 0 && number.decimal.mantissa != 0)) {
+        return fail(error, ParseErrorCode::NumberOutOfRange, start);
+    }
+    return true;
+}
+
+bool numberToInteger(const NumberText& number, int64_t& value) {
+    if (!number.isInteger || number.digits == 0 || number.digits > 19) {
+        return false;
+    }
+    // 19 位以内不会溢出 uint64_t，再检查是否在 int64_t 范围内
+    constexpr uint64_t maxInt64 = static_cast<uint64_t>(INT64_MAX);
+    const uint64_t     mantissa = number.decimal.mantissa;
+    if (mantissa > maxInt64 + (number.decimal.negative ? 1 : 0)) {
+        return false;
+    }
+    value = number.decimal.negative ? static_cast<int64_t>(0 - mantissa)
+                                    : static_cast<int64_t>(mantissa);
+    return true;
+}
+
+/**
+ * @struct LazyNumber
+ * @brief 构造保留原始文本的数字（ENABLE_LAZY_NUMBER）
+ */
+struct LazyNumber {
+    /**
+     * @brief 构造保留原始文本的数字。
+     * @param text 已经校验过的数字文本。
+     * @param type 数字的类型（Integer 或 Double）
+     * @param borrow 是否直接引用 text 而不复制。
+     * @return 数字 JsonValue。
+     */
+    static JsonValue make(std::string_view text, JsonType type, bool borrow) {
+        JsonValue result;
+        result.m_type = type;
+        if (borrow) {
+            result.m_storage    = JsonValue::Storage::Borrowed;
+            result.m_length     = static_cast<uint32_t>(text.size());
+            result.m_value.view = text.data();
+        } else {
+            result.setNumberText(text);
         }
         return result;
     }
+};
+
+/**
+ * @brief 构造位于 arena 中的 JsonValue（ENABLE_ARENA 使用）
+ */
+struct ArenaValue {
+    /**
+     * @brief 把数组或对象移动到 arena 中。
+     * @tparam Container JsonArray 或 JsonObject，其元素存储已经从 arena 分配。
+     * @param container 数组或对象。
+     * @param arena arena。
+     * @return 引用 arena 中的容器的 JsonValue，销毁时只析构不释放。
+     */
+    template <typename Container>
+    static JsonValue make(Container&& container, std::pmr::memory_resource* arena) {
+        void*     memory = arena->allocate(sizeof(Container), alignof(Container));
+        JsonValue result;
+        result.m_storage = JsonValue::Storage::Arena;
+        if constexpr (std::is_same_v<Container, JsonArray>) {
+            result.m_type        = JsonType::Array;
+            result.m_value.array = new (memory) JsonArray(std::move(container));
+        } else {
+            result.m_type         = JsonType::Object;
+            result.m_value.object = new (memory) JsonObject(std::move(container));
+        }
+        return result;
+    }
+
+    /**
+     * @brief 把字符串复制到 arena 中。
+     * @param value 字符串。
+     * @param arena arena。
+     * @return arena 中的副本。
+     */
+    static std::string_view copy(std::string_view value, std::pmr::memory_resource* arena) {
+        if (value.empty()) {
+            return {};
+        }
+        auto* data = static_cast<char*>(arena->allocate(value.size(), 1));
+        std::memcpy(data, value.data(), value.size());
+        return {data, value.size()};
+    }
+};
+
+/**
+ * @brief 判断不能表示为 int64_t 的数字转换为 double 时是否可能超出范围。
+ *
+ * 尾数不超过 2^64 < 10^20，指数在 [-323, 288] 内时结果必然是有限的非零值，
+ * 只有其余的数字才需要实际转换一次来确定是否出错。
+ * @param number 扫描结果。
+ * @return 可能超出范围时返回 true。
+ */
+static bool mayBeOutOfRange(const NumberText& number) noexcept {
+    const int64_t exponent = number.decimal.exponent;
+    return number.digits == 0 ||
+           (number.decimal.mantissa != 0 && (exponent < -323 || exponent > 288));
+}
+
+bool numberToValue(const std::string_view& json, size_t start, size_t end,
+                   const NumberText& number, uint8_t option, JsonValue& value,
+                   ParseError& error) {
+    int64_t integer   = 0;
+    bool    isInteger = numberToInteger(number, integer);
+    if (option & parser::ENABLE_LAZY_NUMBER) {
+        // 可能超出范围的浮点数仍然立即转换一次，保证错误与立即转换时相同
+        double converted;
+        if (!isInteger && mayBeOutOfRange(number) &&
+            !numberToDouble(json, start, end, number, converted, error)) {
+            return false;
+        }
+        // 数字最长不会超过输入本身，引用输入时长度超过 UINT32_MAX 的文本改为复制
+        std::string_view text   = json.substr(start, end - start);
+        const bool       borrow = (option & BORROW_STRINGS) && text.size() <= UINT32_MAX;
+        // int64_t 范围内的整数文本（没有前导零）与转换结果一一对应，放不进值内部时
+        // 直接保存转换结果，序列化结果不变，也省去一次分配
+        if (isInteger && !borrow && text.size() > JsonValue::INLINE_STRING_CAPACITY) {
+            value = integer;
+            return true;
+        }
+        value = LazyNumber::make(text, isInteger ? JsonType::Integer : JsonType::Double, borrow);
+        return true;
+    }
+    if (isInteger) {
+        value = integer;
+        return true;
+    }
+    // 超出 int64_t 范围的整数按浮点数处理
+    double converted;
+    if (!numberToDouble(json, start, end, number, converted, error)) {
+        return false;
+    }
+    value = converted;
+    return true;
+}
+
+double JsonValue::textToDouble() const noexcept {
+    std::string_view text = rawNumber();
+    if (m_type == JsonType::Integer) {
+        return static_cast<double>(textToInteger());
+    }
+    // 原始文本在解析时已经校验过
+    size_t     position = 0;
+    NumberText number;
+    ParseError error;
+    scanNumber(text, position, number, error);
+    return fp::toDouble(number.decimal, text.data(), text.data() + text.size());
 }
 
 std::pair<char32_t, bool> hexToChar32t(const std::string_view& hex) {
@@ -412,48 +974,242 @@ std::pair<char32_t, bool> hexToChar32t(const std::string_view& hex) {
     return {result, true};
 }
 
-std::string parseUnicodeString(char32_t codePoint, size_t position) {
-    std::string result;
+template <typename Output>
+bool parseUnicodeString(char32_t codePoint, Output& result) {
     // 根据 Unicode 码点范围，按 UTF-8 规则分段编码：
     if (codePoint <= 0x007F) {
         // 0x0000~0x007F (1字节)
-        result.push_back(static_cast<char>(codePoint));
+        result += static_cast<char>(codePoint);
     } else if (codePoint <= 0x07FF) {
         // 0x0080~0x07FF (2字节)
-        result.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
-        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        result += static_cast<char>(0xC0 | (codePoint >> 6));
+        result += static_cast<char>(0x80 | (codePoint & 0x3F));
     } else if (codePoint <= 0xFFFF) {
         // 0x0800~0xFFFF (3字节)
-        result.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
-        result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
-        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        result += static_cast<char>(0xE0 | (codePoint >> 12));
+        result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        result += static_cast<char>(0x80 | (codePoint & 0x3F));
     } else if (codePoint <= 0x10FFFF) {
         // 0x10000~0x10FFFF (4字节)
-        result.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
-        result.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
-        result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
-        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        result += static_cast<char>(0xF0 | (codePoint >> 18));
+        result += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        result += static_cast<char>(0x80 | (codePoint & 0x3F));
     } else {
-        throw JsonParseException("Invalid Unicode code point", position);
+        return false;
     }
+    return true;
+}
 
-    return result;
+/**
+ * @brief 从第一个需要特殊处理的字符开始，找到字符串的结束引号。
+ * @param json 输入 JSON 字符串。
+ * @param special 第一个需要特殊处理的字符的位置。
+ * @return 结束引号的位置；遇到控制字符时返回该字符的位置，找不到时返回 json.size()
+ */
+static size_t findStringEnd(const std::string_view& json, size_t special) {
+    while (special < json.size() && json[special] == '\\') {
+        special = simd::findStringSpecial(json.data(), json.size(), special + 2);
+    }
+    return std::min(special, json.size());
 }
 
-JsonValue parseString(const std::string_view& json, size_t& position, uint8_t option) {
+/**
+ * @class InSituOutput
+ * @brief 原地反转义的输出：把反转义的结果写回输入缓冲区中字符串自身所在的位置。
+ *
+ * 标准转义序列都比转义后的字符更长，因此写入位置永远不会超过读取位置。
+ * 扩展转义（\x 和 \0）会被展开为更长的 \uXXXX 文本，放不下时改为写入独立的字符串。
+ */
+class InSituOutput {
+  public:
+    /**
+     * @brief 构造输出。
+     * @param json 输入 JSON 字符串（必须指向可写的内存）
+     * @param position 解析位置的引用，写入时不能超过该位置
+     */
+    InSituOutput(const std::string_view& json, const size_t& position)
+        : m_input(const_cast<char*>(json.data())),
+          m_begin(m_input + position),
+          m_cursor(m_begin),
+          m_position(position) {}
+
+    /**
+     * @brief 追加一段内容。
+     * @param data 内容起始位置，可以指向输入缓冲区中尚未读取的部分
+     * @param size 内容长度。
+     */
+    void append(const char* data, size_t size) {
+        if (!m_spilled) {
+            // 整段拷贝未转义的字符时，源数据从读取位置开始，只要写入位置不超过它就可以 memmove
+            const char* limit = data == m_input + m_position ? data + size : m_input + m_position;
+            if (m_cursor + size <= limit) {
+                if (m_cursor != data) {
+                    std::memmove(m_cursor, data, size);
+                }
+                m_cursor += size;
+                return;
+            }
+            m_spill.reserve(static_cast<size_t>(m_cursor - m_begin) + size);
+            m_spill.assign(m_begin, m_cursor);
+            m_spilled = true;
+        }
+        m_spill.append(data, size);
+    }
+
+    InSituOutput& operator+=(char c) {
+        append(&c, 1);
+        return *this;
+    }
+
+    InSituOutput& operator+=(const std::string& value) {
+        append(value.data(), value.size());
+        return *this;
+    }
+
+    InSituOutput& operator+=(const char* value) {
+        append(value, std::strlen(value));
+        return *this;
+    }
+
+    /**
+     * @brief 结果是否因为放不下而写入了独立的字符串。
+     */
+    bool spilled() const noexcept {
+        return m_spilled;
+    }
+
+    /**
+     * @brief 获取输入缓冲区中的结果（仅在未溢出时有效）
+     */
+    std::string_view view() const noexcept {
+        return {m_begin, static_cast<size_t>(m_cursor - m_begin)};
+    }
+
+    /**
+     * @brief 取出溢出时写入的独立字符串。
+     */
+    JsonString takeSpill() noexcept {
+        return std::move(m_spill);
+    }
+
+  private:
+    char*         m_input;            ///< 输入缓冲区
+    char*         m_begin;            ///< 字符串内容的起始位置
+    char*         m_cursor;           ///< 下一个写入位置
+    const size_t& m_position;         ///< 当前读取位置
+    JsonString    m_spill;            ///< 溢出时使用的独立字符串
+    bool          m_spilled = false;  ///< 是否已经溢出
+};
+
+/**
+ * @class DiscardOutput
+ * @brief 丢弃所有内容的输出，只校验转义序列时使用。
+ */
+class DiscardOutput {
+  public:
+    void append(const char*, size_t) noexcept {}
+
+    DiscardOutput& operator+=(char) noexcept {
+        return *this;
+    }
+
+    DiscardOutput& operator+=(const char*) noexcept {
+        return *this;
+    }
+};
+
+/**
+ * @brief 从第一个需要特殊处理的字符开始，反转义字符串的剩余部分。
+ * @tparam Output 输出类型：JsonString、InSituOutput 或 DiscardOutput
+ * @param json 输入 JSON 字符串。
+ * @param position 当前解析位置（输入输出参数）
+ * @param option 解析选项。
+ * @param special 第一个需要特殊处理的字符的位置。
+ * @param result 反转义的结果（输出参数）
+ * @param error 解析错误（输出参数）
+ * @return 字符串格式有效时返回 true。
+ */
+template <typename Output>
+static bool unescapeString(const std::string_view& json,
+                           size_t&                 position,
+                           uint8_t                 option,
+                           size_t                  special,
+                           Output&                 result,
+                           ParseError&             error);
+
+StringScan scanString(const std::string_view& json,
+                      size_t&                 position,
+                      uint8_t                 option,
+                      JsonString&             result,
+                      std::string_view&       raw,
+                      ParseError&             error) {
     // 当前字符串一定为"
     // 跳过开头的"
     position++;
-    JsonString result;
+    // 找到第一个需要特殊处理的字符，如果它就是结束引号，说明字符串没有转义，不需要复制
+    size_t special = simd::findStringSpecial(json.data(), json.size(), position);
+    if (special < json.size() && json[special] == '"') {
+        raw      = json.substr(position, special - position);
+        position = special + 1;
+        return StringScan::Raw;
+    }
+    if (option & DISCARD_STRINGS) {
+        // raw 为未经反转义的原文
+        DiscardOutput output;
+        const size_t  start = position;
+        if (!unescapeString(json, position, option, special, output, error)) {
+            return StringScan::Failed;
+        }
+        raw = json.substr(start, position - 1 - start);
+        return StringScan::Raw;
+    }
+    if (option & IN_SITU) {
+        InSituOutput output(json, position);
+        if (!unescapeString(json, position, option, special, output, error)) {
+            return StringScan::Failed;
+        }
+        if (output.spilled()) {
+            result = output.takeSpill();
+            return StringScan::Unescaped;
+        }
+        raw = output.view();
+        return StringScan::Raw;
+    }
+    // 标准转义序列都比转义后的字符更长，以到结束引号的距离作为预留长度，保证只分配一次
+    if (size_t end = findStringEnd(json, special); end > position) {
+        result.reserve(end - position);
+    }
+    if (!unescapeString(json, position, option, special, result, error)) {
+        return StringScan::Failed;
+    }
+    return StringScan::Unescaped;
+}
+
+template <typename Output>
+bool unescapeString(const std::string_view& json,
+                    size_t&                 position,
+                    uint8_t                 option,
+                    size_t                  special,
+                    Output&                 result,
+                    ParseError&             error) {
     // 读取后面的字符串
     while (position < json.size()) {
-        char c = json[position++];
-        if (c == '"') {
-            return result;
+        // 普通字符整段拷贝
+        if (special > position) {
+            result.append(json.data() + position, special - position);
+            position = special;
+            if (position >= json.size()) {
+                break;
+            }
+        }
+        char c = json[position++];
+        if (c == '"') {
+            return true;
         } else if (c == '\\') {
             // 如果c为\,说明遇到了转移字符
             if (position >= json.size()) {
-                throw JsonParseException("Unexpected end of string", position);
+                return fail(error, ParseErrorCode::UnexpectedEndOfString, position);
             }
             // 转义字符后的字符
             c = json[position++];
@@ -469,7 +1225,7 @@ JsonValue parseString(const std::string_view& json, size_t& position, uint8_t op
                 case 'u': {
                     // unicode字符\u后必须跟随4个字符（代表码点）
                     if (position + 4 >= json.size()) {
-                        throw JsonParseException("Invalid unicode escape sequence", position);
+                        return fail(error, ParseErrorCode::InvalidUnicodeEscape, position);
                     }
                     auto hex = json.substr(position, 4);
                     position += 4;
@@ -481,8 +1237,7 @@ JsonValue parseString(const std::string_view& json, size_t& position, uint8_t op
                             // 验证是否存在第二个代理
                             if (position + 6 > json.size() || json[position] != '\\' ||
                                 json[position + 1] != 'u') {
-                                throw JsonParseException("Missing low surrogate in UTF-16 pair",
-                                                         position);
+                                return fail(error, ParseErrorCode::MissingLowSurrogate, position);
                             }
                             // 跳过\u
                             position += 2;
@@ -491,35 +1246,41 @@ JsonValue parseString(const std::string_view& json, size_t& position, uint8_t op
                             position += 4;
                             if (auto [lowCode, ok] = hexToChar32t(lowHex); ok) {
                                 if (lowCode < 0xDC00 || lowCode > 0xDFFF) {
-                                    throw JsonParseException("Invalid low surrogate in \\u escape",
-                                                             position);
+                                    return fail(
+                                        error, ParseErrorCode::InvalidLowSurrogate, position);
                                 }
                                 // 计算实际码点
                                 codePoint =
                                     0x10000 + ((codePoint - 0xD800) << 10) + (lowCode - 0xDC00);
                             } else {
-                                throw JsonParseException("Invalid unicode escape sequence",
-                                                         position);
+                                return fail(error, ParseErrorCode::InvalidUnicodeEscape, position);
                             }
                         }
                         // 解析unicode编码
-                        result += parseUnicodeString(codePoint, position);
+                        if (!parseUnicodeString(codePoint, result)) {
+                            return fail(error, ParseErrorCode::InvalidCodePoint, position);
+                        }
                     } else {
-                        throw JsonParseException("Invalid unicode escape sequence", position);
+                        return fail(error, ParseErrorCode::InvalidUnicodeEscape, position);
                     }
                     break;
                 }
                 case 'x': {
                     if (option & parser::ENABLE_PARSE_X_ESCAPE_SEQUENCE) {
                         // 收集所有连续的 \xHH 字节
-                        std::vector<uint8_t> utf8Bytes;
+                        // 超过 4 个字节时只计数不保存，未填充的字节为 0，解码时不会越界读取
+                        uint8_t utf8Bytes[4] = {};
+                        size_t  byteCount    = 0;
                         while (position + 2 < json.size()) {
                             auto hex = json.substr(position, 2);
                             position += 2;
                             if (auto [byte, success] = hexToChar32t(hex); success) {
-                                utf8Bytes.push_back(static_cast<uint8_t>(byte));
+                                if (byteCount < 4) {
+                                    utf8Bytes[byteCount] = static_cast<uint8_t>(byte);
+                                }
+                                ++byteCount;
                             } else {
-                                throw JsonParseException("Invalid \\x escape sequence", position);
+                                return fail(error, ParseErrorCode::InvalidXEscape, position);
                             }
                             // 检查是否还有下一个 \x
                             if (position + 3 < json.size() && json[position] == '\\' &&
@@ -530,8 +1291,8 @@ JsonValue parseString(const std::string_view& json, size_t& position, uint8_t op
                             }
                         }
                         // \x必须有内容
-                        if (utf8Bytes.empty() || utf8Bytes.size() > 4) {
-                            throw JsonParseException("Invalid \\x escape sequence size", position);
+                        if (byteCount == 0 || byteCount > 4) {
+                            return fail(error, ParseErrorCode::InvalidXEscapeSize, position);
                         }
                         // 解码 UTF-8 → Unicode 码点
                         char32_t codePoint = 0;
@@ -553,150 +1314,2248 @@ JsonValue parseString(const std::string_view& json, size_t& position, uint8_t op
                             i = 4;
                         }
 
-                        // 检查是否完全解码
-                        if (i != utf8Bytes.size()) {
-                            throw JsonParseException("Invalid UTF-8 sequence", position);
-                        }
+                        // 检查是否完全解码
+                        if (i != byteCount) {
+                            return fail(error, ParseErrorCode::InvalidXEscapeUtf8, position);
+                        }
+
+                        // 编码 Unicode 码点 → \uXXXX or \uXXXX\uXXXX (代理对)
+                        if (codePoint <= 0xFFFF) {
+                            // 基本平面（BMP）
+                            char buffer[7];
+                            snprintf(buffer, sizeof(buffer), "\\u%04X", codePoint);
+                            result += buffer;
+                        } else {
+                            // 补充平面（Surrogate Pair）
+                            codePoint -= 0x10000;
+                            auto highSurrogate = static_cast<uint16_t>((codePoint >> 10) + 0xD800);
+                            auto lowSurrogate = static_cast<uint16_t>((codePoint & 0x3FF) + 0xDC00);
+                            char buffer[7];
+                            snprintf(buffer, sizeof(buffer), "\\u%04X", highSurrogate);
+                            result += buffer;
+                            snprintf(buffer, sizeof(buffer), "\\u%04X", lowSurrogate);
+                            result += buffer;
+                        }
+                    } else {
+                        return fail(error, ParseErrorCode::XEscapeDisabled, position);
+                    }
+                    break;
+                }
+                case '0': {
+                    if (option & parser::ENABLE_PARSE_0_ESCAPE_SEQUENCE) {
+                        // \0 转为 \u0000
+                        result += "\\u0000";
+                    } else {
+                        return fail(error, ParseErrorCode::InvalidZeroEscape, position);
+                    }
+                    break;
+                }
+                default: return fail(error, ParseErrorCode::InvalidEscape, position);
+            }
+        } else {
+            // 不是引号和转义符，只能是控制字符
+            return fail(error, ParseErrorCode::ControlCharacter, position);
+        }
+        special = simd::findStringSpecial(json.data(), json.size(), position);
+    }
+    return fail(error, ParseErrorCode::UnexpectedEndOfString, position);
+}
+
+/**
+ * @brief 解析数组和对象时使用的容器栈帧。
+ */
+struct ParseFrame {
+    size_t values;    ///< 该容器的第一个元素在值栈中的位置
+    size_t keys;      ///< 该容器的第一个键在键栈中的位置
+    bool   isObject;  ///< 是否为对象
+};
+
+/**
+ * @brief 解析过程中使用的栈。
+ *
+ * 容器的元素（以及对象的键）先依次压入值栈（键栈），容器结束时再一次性移动到容器中，
+ * 因此每个数组的存储都按最终大小只分配一次，键和值也只会被移动而不会被复制。
+ */
+struct ParseStack {
+    std::vector<ParseFrame> frames;  ///< 尚未结束的数组和对象
+    std::vector<JsonValue>  values;  ///< 尚未结束的容器中已经解析完成的元素
+    std::vector<JsonObjectKey> keys;    ///< 尚未结束的对象中已经解析完成的键
+
+    /**
+     * @brief 开始一个数组或对象。
+     * @param isObject 是否为对象。
+     */
+    void open(bool isObject) {
+        frames.push_back({values.size(), keys.size(), isObject});
+    }
+
+    /**
+     * @brief 结束栈顶的数组或对象，把属于它的元素移动到新建的容器中。
+     * @param arena 非空时容器及其元素存储都从 arena 中分配。
+     * @return 构建完成的数组或对象。
+     */
+    JsonValue close(std::pmr::memory_resource* arena) {
+        const ParseFrame frame = frames.back();
+        frames.pop_back();
+        auto first    = values.begin() + static_cast<std::ptrdiff_t>(frame.values);
+        auto resource = arena != nullptr ? arena : std::pmr::get_default_resource();
+        if (!frame.isObject) {
+            JsonArray array(std::make_move_iterator(first),
+                            std::make_move_iterator(values.end()),
+                            resource);
+            values.erase(first, values.end());
+            return arena != nullptr ? ArenaValue::make(std::move(array), arena)
+                                    : JsonValue(std::move(array));
+        }
+        JsonObject object(resource);
+        object.reserve(values.size() - frame.values);
+        for (size_t i = frame.values, k = frame.keys; i < values.size(); ++i, ++k) {
+            // 键重复时保留第一次出现的值
+            object.try_emplace(std::move(keys[k]), std::move(values[i]));
+        }
+        values.erase(first, values.end());
+        keys.erase(keys.begin() + static_cast<std::ptrdiff_t>(frame.keys), keys.end());
+        return arena != nullptr ? ArenaValue::make(std::move(object), arena)
+                                : JsonValue(std::move(object));
+    }
+
+    /**
+     * @brief 清空栈，保留已分配的容量。
+     */
+    void clear() {
+        frames.clear();
+        values.clear();
+        keys.clear();
+    }
+};
+
+/**
+ * @brief 从当前线程复用的解析栈中借出一个栈。
+ *
+ * 栈的容量在多次解析之间保留，避免每次解析都重新分配；
+ * 如果当前线程的栈正在被使用（解析过程中再次调用解析），则改用一个临时栈。
+ */
+class ParseStackLease {
+public:
+    ParseStackLease() {
+        if (!t_inUse) {
+            t_inUse = true;
+            m_stack = &t_stack;
+        } else {
+            m_stack = &m_local;
+        }
+    }
+
+    ~ParseStackLease() {
+        // 解析失败时栈中可能残留未完成的容器
+        m_stack->clear();
+        if (m_stack == &t_stack) {
+            t_inUse = false;
+        }
+    }
+
+    ParseStackLease(const ParseStackLease&)            = delete;
+    ParseStackLease& operator=(const ParseStackLease&) = delete;
+
+    ParseStack& operator*() const {
+        return *m_stack;
+    }
+
+private:
+    static thread_local ParseStack t_stack;
+    static thread_local bool       t_inUse;
+
+    ParseStack  m_local;
+    ParseStack* m_stack;
+};
+
+thread_local ParseStack ParseStackLease::t_stack;
+thread_local bool       ParseStackLease::t_inUse = false;
+
+/**
+ * @brief 记录尚未结束的容器是数组还是对象，每层只占一位。
+ *
+ * 前 64 层保存在对象内部，更深的嵌套才需要分配内存。
+ */
+class ContainerStack {
+public:
+    size_t depth() const noexcept {
+        return m_depth;
+    }
+
+    bool empty() const noexcept {
+        return m_depth == 0;
+    }
+
+    /**
+     * @brief 栈顶的容器是否为对象（栈不能为空）
+     */
+    bool inObject() const noexcept {
+        return (m_top >> ((m_depth - 1) % 64)) & 1;
+    }
+
+    void push(bool isObject) {
+        if (m_depth != 0 && m_depth % 64 == 0) {
+            m_spill.push_back(m_top);
+            m_top = 0;
+        }
+        m_top |= static_cast<uint64_t>(isObject) << (m_depth % 64);
+        m_depth++;
+    }
+
+    void pop() {
+        m_depth--;
+        m_top &= ~(uint64_t{1} << (m_depth % 64));
+        if (m_depth != 0 && m_depth % 64 == 0) {
+            m_top = m_spill.back();
+            m_spill.pop_back();
+        }
+    }
+
+private:
+    uint64_t              m_top   = 0;  ///< 最内层 64 个容器的标记
+    size_t                m_depth = 0;  ///< 尚未结束的容器个数
+    std::vector<uint64_t> m_spill;      ///< 更外层容器的标记
+};
+
+/**
+ * @brief 构建 DOM 的事件处理器（parse、parseDocument、parseInSitu 共用）
+ *
+ * 标量直接构造为 JsonValue，容器的元素先压入 ParseStack，容器结束时一次性移动到容器中。
+ * 不含转义的字符串在 BORROW_STRINGS 时直接引用输入，含转义的字符串接管词法分析器的反转义结果。
+ * 指定字符串池时，键和不超过 pool->maxValueLength() 字节的字符串值引用池中的副本；
+ * 指定 arena 时，容器和含转义的字符串都从 arena 中分配。
+ * 数字超出范围时把错误记录在 error 中并返回 false，词法分析器随之停止。
+ */
+class DomBuilder {
+public:
+    DomBuilder(ParseStack& stack, uint8_t option, ParseError& error, DomStorage storage = {})
+        : m_stack(stack), m_option(option), m_error(error), m_pool(storage.pool),
+          m_arena(storage.arena) {}
+
+    bool null() {
+        return add(nullptr);
+    }
+
+    bool boolean(bool value) {
+        return add(value);
+    }
+
+    bool number(const std::string_view& json, size_t start, size_t end, const NumberText& number) {
+        JsonValue value;
+        if (!numberToValue(json, start, end, number, m_option, value, m_error)) {
+            return false;
+        }
+        return add(std::move(value));
+    }
+
+    bool string(std::string_view raw, JsonString* unescaped) {
+        if (m_pool != nullptr) {
+            const std::string_view value = unescaped != nullptr ? *unescaped : raw;
+            if (value.size() <= m_pool->maxValueLength()) {
+                return add(JsonValue::borrow(m_pool->intern(value)));
+            }
+        }
+        if (unescaped != nullptr) {
+            if (m_arena != nullptr) {
+                return add(JsonValue::borrow(ArenaValue::copy(*unescaped, m_arena)));
+            }
+            return add(JsonValue(std::move(*unescaped)));
+        }
+        if (m_option & BORROW_STRINGS) {
+            return add(JsonValue::borrow(raw));
+        }
+        return add(JsonValue(raw));
+    }
+
+    bool key(std::string_view raw, JsonString* unescaped) {
+        JsonObjectKey& key = m_stack.keys.emplace_back();
+        if (m_pool != nullptr) {
+            key = JsonObjectKey::borrow(m_pool->intern(unescaped != nullptr ? *unescaped : raw));
+        } else if (unescaped != nullptr && m_arena != nullptr) {
+            key = JsonObjectKey::borrow(ArenaValue::copy(*unescaped, m_arena));
+        } else if (unescaped != nullptr) {
+            key = JsonObjectKey(std::move(*unescaped));
+        } else if (m_option & BORROW_STRINGS) {
+            key = JsonObjectKey::borrow(raw);
+        } else {
+            key = JsonObjectKey(raw);
+        }
+        return true;
+    }
+
+    bool startObject() {
+        m_stack.open(true);
+        return true;
+    }
+
+    bool endObject() {
+        return add(m_stack.close(m_arena));
+    }
+
+    bool startArray() {
+        m_stack.open(false);
+        return true;
+    }
+
+    bool endArray() {
+        return add(m_stack.close(m_arena));
+    }
+
+    /**
+     * @brief 取出构建完成的根节点。
+     */
+    JsonValue take() {
+        return std::move(m_result);
+    }
+
+private:
+    /**
+     * @brief 一个值构建完成，作为栈顶容器的元素（没有容器时即为根节点）
+     */
+    bool add(JsonValue value) {
+        if (m_stack.frames.empty()) {
+            m_result = std::move(value);
+        } else {
+            m_stack.values.emplace_back(std::move(value));
+        }
+        return true;
+    }
+
+    ParseStack&                m_stack;   ///< 尚未结束的容器
+    uint8_t                    m_option;  ///< 解析选项
+    ParseError&                m_error;   ///< 数字转换失败时记录错误
+    StringPool*                m_pool;    ///< 键和短字符串值使用的字符串池，可以为空
+    std::pmr::memory_resource* m_arena;   ///< 容器和含转义的字符串使用的 arena，可以为空
+    JsonValue                  m_result;  ///< 根节点
+};
+
+/**
+ * @brief 将词法分析器的事件转发给用户提供的 JsonHandler。
+ *
+ * 与 DomBuilder 相同，数字超出范围时把错误记录在 error 中并返回 false。
+ */
+class HandlerAdapter {
+public:
+    HandlerAdapter(JsonHandler& handler, ParseError& error) : m_handler(handler), m_error(error) {}
+
+    bool null() {
+        return m_handler.onNull();
+    }
+
+    bool boolean(bool value) {
+        return m_handler.onBool(value);
+    }
+
+    bool number(const std::string_view& json, size_t start, size_t end, const NumberText& number) {
+        int64_t integer = 0;
+        if (numberToInteger(number, integer)) {
+            return m_handler.onInt64(integer);
+        }
+        double value;
+        if (!numberToDouble(json, start, end, number, value, m_error)) {
+            return false;
+        }
+        return m_handler.onDouble(value);
+    }
+
+    bool string(std::string_view raw, JsonString* unescaped) {
+        return m_handler.onString(unescaped != nullptr ? std::string_view(*unescaped) : raw);
+    }
+
+    bool key(std::string_view raw, JsonString* unescaped) {
+        return m_handler.onKey(unescaped != nullptr ? std::string_view(*unescaped) : raw);
+    }
+
+    bool startObject() {
+        return m_handler.onStartObject();
+    }
+
+    bool endObject() {
+        return m_handler.onEndObject();
+    }
+
+    bool startArray() {
+        return m_handler.onStartArray();
+    }
+
+    bool endArray() {
+        return m_handler.onEndArray();
+    }
+
+private:
+    JsonHandler& m_handler;  ///< 用户的事件处理器
+    ParseError&  m_error;    ///< 数字转换失败时记录错误
+};
+
+/**
+ * @brief 只做校验的事件处理器（validate 使用）：忽略所有事件，不构建任何结果。
+ *
+ * 数字只在可能超出范围时转换，保证与 parse 报告相同的错误。
+ */
+class Validator {
+public:
+    explicit Validator(ParseError& error) : m_error(error) {}
+
+    bool null() noexcept {
+        return true;
+    }
+
+    bool boolean(bool) noexcept {
+        return true;
+    }
+
+    bool number(const std::string_view& json, size_t start, size_t end, const NumberText& number) {
+        int64_t integer = 0;
+        if (numberToInteger(number, integer) || !mayBeOutOfRange(number)) {
+            return true;
+        }
+        double value;
+        return numberToDouble(json, start, end, number, value, m_error);
+    }
+
+    bool string(std::string_view, JsonString*) noexcept {
+        return true;
+    }
+
+    bool key(std::string_view, JsonString*) noexcept {
+        return true;
+    }
+
+    bool startObject() noexcept {
+        return true;
+    }
+
+    bool endObject() noexcept {
+        return true;
+    }
+
+    bool startArray() noexcept {
+        return true;
+    }
+
+    bool endArray() noexcept {
+        return true;
+    }
+
+private:
+    ParseError& m_error;  ///< 数字转换失败时记录错误
+};
+
+/**
+ * @brief 扫描一个字符串或键，并交给 handler。
+ * @param json 输入 JSON 字符串。
+ * @param position 开头引号的位置（输入输出参数）
+ * @param option 解析选项。
+ * @param unescaped 存放反转义结果的缓冲区，handler 可以接管其内容。
+ * @param handler 事件处理器。
+ * @param error 解析错误（输出参数）
+ * @return handler 的返回值；字符串格式无效时返回 false。
+ */
+template <bool IsKey, typename Handler>
+static bool emitString(const std::string_view& json,
+                       size_t&                 position,
+                       uint8_t                 option,
+                       JsonString&             unescaped,
+                       Handler&                handler,
+                       ParseError&             error) {
+    std::string_view raw;
+    unescaped.clear();
+    const StringScan scan = scanString(json, position, option, unescaped, raw, error);
+    if (scan == StringScan::Failed) {
+        return false;
+    }
+    JsonString* result = scan == StringScan::Unescaped ? &unescaped : nullptr;
+    if constexpr (IsKey) {
+        return handler.key(raw, result);
+    } else {
+        return handler.string(raw, result);
+    }
+}
+
+/**
+ * @brief 扫描一个数字，并交给 handler。
+ * @param json 输入 JSON 字符串。
+ * @param position 当前解析位置（输入输出参数）
+ * @param handler 事件处理器。
+ * @param error 解析错误（输出参数）
+ * @return handler 的返回值；数值格式无效时返回 false。
+ */
+template <typename Handler>
+static bool emitNumber(const std::string_view& json,
+                       size_t&                 position,
+                       Handler&                handler,
+                       ParseError&             error) {
+    const size_t start = position;
+    NumberText   number;
+    if (!scanNumber(json, position, number, error)) {
+        return false;
+    }
+    return handler.number(json, start, position, number);
+}
+
+/**
+ * @brief 逐字符的词法分析器：按文档顺序把解析事件交给 handler。
+ *
+ * 使用显式的容器栈代替递归，嵌套深度不受调用栈大小的限制。构建 DOM（DomBuilder）和
+ * SAX 接口（HandlerAdapter）共用该函数，因此两者的语法检查和错误信息完全相同。
+ * @param json 输入 JSON 字符串。
+ * @param position 当前解析位置（输入输出参数）
+ * @param option 解析选项。
+ * @param maxDepth 数组/对象的最大嵌套深度，0 表示不限制
+ * @param handler 事件处理器，任一事件返回 false 时停止解析。
+ * @param error 解析错误（输出参数）
+ * @return 完整解析一个值时返回 true；handler 要求停止、解析失败或嵌套过深时返回 false，
+ *         后两种情况下 error 记录了错误。
+ */
+template <typename Handler>
+static bool parseEvents(const std::string_view& json,
+                        size_t&                 position,
+                        uint8_t                 option,
+                        size_t                  maxDepth,
+                        Handler&                handler,
+                        ParseError&             error) {
+    ContainerStack containers;
+    JsonString     unescaped;  // 含转义字符的字符串的反转义结果
+
+parseValue:
+    // 跳过无用字符
+    skipUselessChar(json, position);
+    // 范围检测
+    if (position >= json.size()) {
+        return fail(error, ParseErrorCode::UnexpectedEndOfInput, position);
+    }
+    // 根据第一个字符判断接来要解析什么
+    switch (json[position]) {
+        case 'n':
+            if (!parseNull(json, position, error) || !handler.null()) {
+                return false;
+            }
+            break;
+        case 't':
+        case 'f': {
+            bool value;
+            if (!parseBoolean(json, position, value, error) || !handler.boolean(value)) {
+                return false;
+            }
+            break;
+        }
+        case '"':
+            if (!emitString<false>(json, position, option, unescaped, handler, error)) {
+                return false;
+            }
+            break;
+        case '[':
+            if (maxDepth != 0 && containers.depth() >= maxDepth) {
+                return fail(error, ParseErrorCode::MaxDepthExceeded, position);
+            }
+            if (!handler.startArray()) {
+                return false;
+            }
+            // 跳过[
+            position++;
+            // 跳过无用字符串
+            skipUselessChar(json, position);
+            if (position >= json.size()) {
+                return fail(error, ParseErrorCode::UnexpectedEndOfArray, position);
+            }
+            // 如果遇到了]
+            if (json[position] == ']') {
+                position++;
+                if (!handler.endArray()) {
+                    return false;
+                }
+                break;
+            }
+            containers.push(false);
+            goto parseValue;
+        case '{':
+            if (maxDepth != 0 && containers.depth() >= maxDepth) {
+                return fail(error, ParseErrorCode::MaxDepthExceeded, position);
+            }
+            if (!handler.startObject()) {
+                return false;
+            }
+            position++;
+            // 跳过无用字符
+            skipUselessChar(json, position);
+            // 范围检测
+            if (position >= json.size()) {
+                return fail(error, ParseErrorCode::UnexpectedEndOfObject, position);
+            }
+            // 是否已经结束
+            if (json[position] == '}') {
+                position++;
+                if (!handler.endObject()) {
+                    return false;
+                }
+                break;
+            }
+            containers.push(true);
+            goto parseKey;
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            if (!emitNumber(json, position, handler, error)) {
+                return false;
+            }
+            break;
+        default:
+            error.character = json[position];
+            return fail(error, ParseErrorCode::UnexpectedCharacter, position);
+    }
+
+    // 一个值解析完成，检查栈顶容器是否结束
+    while (!containers.empty()) {
+        if (!containers.inObject()) {
+            // 无用字符
+            skipUselessChar(json, position);
+            if (position >= json.size()) {
+                return fail(error, ParseErrorCode::UnexpectedEndOfArray, position);
+            }
+            // 如果遇到了]
+            if (json[position] == ']') {
+                position++;
+                containers.pop();
+                if (!handler.endArray()) {
+                    return false;
+                }
+                continue;
+            }
+            // 如果不是]那就必须为,
+            if (json[position] != ',') {
+                return fail(error, ParseErrorCode::ExpectedArraySeparator, position);
+            }
+            position++;
+            // 输入在容器内结束时，无论末尾是否有空白都报告同样的错误
+            skipUselessChar(json, position);
+            if (position >= json.size()) {
+                return fail(error, ParseErrorCode::UnexpectedEndOfArray, position);
+            }
+            goto parseValue;
+        }
+        skipUselessChar(json, position);
+        if (position >= json.size()) {
+            return fail(error, ParseErrorCode::UnexpectedEndOfObject, position);
+        }
+        // 如果遇到了}
+        if (json[position] == '}') {
+            position++;
+            containers.pop();
+            if (!handler.endObject()) {
+                return false;
+            }
+            continue;
+        }
+        // 如果不是}那就必须为,
+        if (json[position] != ',') {
+            return fail(error, ParseErrorCode::ExpectedObjectSeparator, position);
+        }
+        position++;
+        skipUselessChar(json, position);
+        if (position >= json.size()) {
+            return fail(error, ParseErrorCode::UnexpectedEndOfObject, position);
+        }
+        goto parseKey;
+    }
+    return true;
+
+parseKey:
+    skipUselessChar(json, position);
+    // 解析key
+    if (position < json.size() && json[position] != '"') {
+        return fail(error, ParseErrorCode::KeyNotString, position);
+    }
+    if (!emitString<true>(json, position, option, unescaped, handler, error)) {
+        return false;
+    }
+    skipUselessChar(json, position);
+    // 是否超范围,或者是否没有:
+    if (position >= json.size() || json[position] != ':') {
+        return fail(error, ParseErrorCode::UnexpectedEndOfObject, position);
+    }
+    position++;
+    // 准备解析值
+    goto parseValue;
+}
+
+bool parseValue(const std::string_view& json,
+                size_t&                 position,
+                uint8_t                 option,
+                size_t                  maxDepth,
+                JsonValue&              result,
+                ParseError&             error,
+                DomStorage              storage) {
+    ParseStackLease lease;
+    DomBuilder      builder(*lease, option, error, storage);
+    // DomBuilder 的事件只会因为错误而返回 false
+    if (!parseEvents(json, position, option, maxDepth, builder, error)) {
+        return false;
+    }
+    result = builder.take();
+    return true;
+}
+
+/**
+ * @brief 解析一个 JSON 值，失败时抛出异常。
+ * @param json 输入 JSON 字符串。
+ * @param position 当前解析位置（输入输出参数）
+ * @param option 解析选项。
+ * @param maxDepth 最大嵌套深度，0 表示不限制。
+ * @return 解析结果。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonValue parseValue(const std::string_view& json,
+                            size_t&                 position,
+                            uint8_t                 option,
+                            size_t                  maxDepth) {
+    JsonValue  result;
+    ParseError error;
+    if (!parseValue(json, position, option, maxDepth, result, error)) {
+        throwParseError(error);
+    }
+    return result;
+}
+
+/**
+ * @brief 判断字符是否结束一个标量。
+ *
+ * 跳过式扫描把连续的非空白、非结构字符视为一个标量。
+ * @param c 标量之后的字符。
+ * @return 如果是空白、结构字符或引号，返回 true。
+ */
+static inline bool isScalarEnd(char c) {
+    switch (c) {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+        case ',':
+        case ':':
+        case '[':
+        case ']':
+        case '{':
+        case '}':
+        case '"': return true;
+        default: return false;
+    }
+}
+
+/**
+ * @brief 解析完整的 JSON 文档（parse 与 parseDocument 共用）
+ * @param json 输入 JSON 字符串。
+ * @param option 解析选项（可以包含内部选项 BORROW_STRINGS）
+ * @param maxDepth 最大嵌套深度，0 表示不限制。
+ * @param result 解析结果（输出参数）
+ * @param error 解析错误（输出参数）
+ * @param storage 构建 DOM 时使用的字符串池和 arena。
+ * @return 解析成功返回 true。
+ */
+static bool parseDocumentRoot(std::string_view json,
+                              uint8_t          option,
+                              size_t           maxDepth,
+                              JsonValue&       result,
+                              ParseError&      error,
+                              DomStorage       storage = {}) {
+    size_t position = 0;
+    if (!parseValue(json, position, option, maxDepth, result, error, storage)) {
+        return false;
+    }
+    skipUselessChar(json, position);
+    // 按道理现在应该不存在json数据了
+    if (position != json.size()) {
+        return fail(error, ParseErrorCode::UnexpectedContent, position);
+    }
+    return true;
+}
+
+/**
+ * @brief 解析完整的 JSON 文档，失败时抛出异常。
+ * @param json 输入 JSON 字符串。
+ * @param option 解析选项（可以包含内部选项 BORROW_STRINGS）
+ * @param maxDepth 最大嵌套深度，0 表示不限制。
+ * @param storage 构建 DOM 时使用的字符串池和 arena。
+ * @return 解析结果。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonValue parseDocumentRoot(std::string_view json,
+                                   uint8_t          option,
+                                   size_t           maxDepth,
+                                   DomStorage       storage = {}) {
+    JsonValue  result;
+    ParseError error;
+    if (!parseDocumentRoot(json, option, maxDepth, result, error, storage)) {
+        throwParseError(error);
+    }
+    return result;
+}
+
+/**
+ * @brief 按 ENABLE_ARENA 为 Document 创建 arena。
+ * @param options 解析配置。
+ * @param size 输入长度，用于估计第一块 arena 的大小。
+ * @return 未启用 ENABLE_ARENA 时返回空指针。
+ */
+static std::unique_ptr<std::pmr::monotonic_buffer_resource> makeArena(
+    const parser::ParserOptions& options, size_t size) {
+    if (!(options.flags & parser::ENABLE_ARENA)) {
+        return nullptr;
+    }
+    // 树的大小与输入大致相当，之后的块由 monotonic_buffer_resource 按几何级数增长
+    return std::make_unique<std::pmr::monotonic_buffer_resource>(std::max<size_t>(size, 4096));
+}
+
+namespace parser {
+    JsonValue parse(std::string_view json, const ParserOptions& options) {
+        auto flags = static_cast<uint8_t>(options.flags & ~(BORROW_STRINGS | IN_SITU));
+        return parseDocumentRoot(json, flags, options.maxDepth);
+    }
+
+    bool tryParse(std::string_view     json,
+                  JsonValue&           out,
+                  ParseError&          error,
+                  const ParserOptions& options) {
+        auto       flags = static_cast<uint8_t>(options.flags & ~(BORROW_STRINGS | IN_SITU));
+        JsonValue  result;
+        if (!parseDocumentRoot(json, flags, options.maxDepth, result, error)) {
+            return false;
+        }
+        out = std::move(result);
+        return true;
+    }
+
+    bool validate(std::string_view json, ParseError& error, const ParserOptions& options) {
+        // 字符串之外的非 ASCII 字节必然是语法错误，因此先整体校验一遍 UTF-8，
+        // 再按语法错误与编码错误中位置靠前的一个报告
+        const size_t invalid = simd::validateUtf8(json.data(), json.size());
+        auto         flags   = static_cast<uint8_t>((options.flags & ~(BORROW_STRINGS | IN_SITU)) |
+                                                    DISCARD_STRINGS);
+        ParseError result;
+        Validator  validator(result);
+        size_t     position = 0;
+        if (parseEvents(json, position, flags, options.maxDepth, validator, result)) {
+            skipUselessChar(json, position);
+            if (position != json.size()) {
+                fail(result, ParseErrorCode::UnexpectedContent, position);
+            }
+        }
+        if (invalid < json.size() && (!result || invalid < result.offset)) {
+            fail(result, ParseErrorCode::InvalidUtf8, invalid);
+        }
+        if (result) {
+            error = result;
+            return false;
+        }
+        return true;
+    }
+
+    bool validate(std::string_view json, const ParserOptions& options) {
+        ParseError error;
+        return validate(json, error, options);
+    }
+
+    bool parse(std::string_view json, JsonHandler& handler, const ParserOptions& options) {
+        auto           flags    = static_cast<uint8_t>(options.flags & ~(BORROW_STRINGS | IN_SITU));
+        size_t         position = 0;
+        ParseError     error;
+        HandlerAdapter adapter(handler, error);
+        if (!parseEvents(json, position, flags, options.maxDepth, adapter, error)) {
+            if (error) {
+                throwParseError(error);
+            }
+            return false;
+        }
+        skipUselessChar(json, position);
+        if (position != json.size()) {
+            throw JsonParseException("Unexpected content after JSON value", position);
+        }
+        return true;
+    }
+
+    Document parseDocument(std::string json, const ParserOptions& options) {
+        auto     owner = std::make_shared<const std::string>(std::move(json));
+        Document document;
+        document.m_buffer = *owner;
+        document.m_owner  = std::move(owner);
+        document.m_arena  = makeArena(options, document.m_buffer.size());
+        document.m_root   = parseDocumentRoot(document.m_buffer,
+                                            options.flags | BORROW_STRINGS,
+                                            options.maxDepth,
+                                            {nullptr, document.m_arena.get()});
+        return document;
+    }
+
+    Document parseDocument(std::string_view             json,
+                           std::shared_ptr<const void> owner,
+                           const ParserOptions&        options) {
+        Document document;
+        document.m_owner  = std::move(owner);
+        document.m_buffer = json;
+        document.m_arena  = makeArena(options, json.size());
+        document.m_root   = parseDocumentRoot(json,
+                                            options.flags | BORROW_STRINGS,
+                                            options.maxDepth,
+                                            {nullptr, document.m_arena.get()});
+        return document;
+    }
+
+    Document parseInSitu(char* buf, size_t len, const ParserOptions& options) {
+        auto     flags = static_cast<uint8_t>(options.flags | BORROW_STRINGS | IN_SITU);
+        Document document;
+        document.m_buffer = std::string_view(buf, len);
+        document.m_arena  = makeArena(options, len);
+        document.m_root   = parseDocumentRoot(
+            document.m_buffer, flags, options.maxDepth, {nullptr, document.m_arena.get()});
+        return document;
+    }
+
+    Document parseInterned(std::string_view            json,
+                           std::shared_ptr<StringPool> pool,
+                           const ParserOptions&        options) {
+        if (pool == nullptr) {
+            pool = std::make_shared<StringPool>();
+        }
+        auto       flags = static_cast<uint8_t>(options.flags & ~(BORROW_STRINGS | IN_SITU));
+        JsonValue  root;
+        ParseError error;
+        {
+            std::lock_guard<StringPool> guard(*pool);
+            if (!parseDocumentRoot(json, flags, options.maxDepth, root, error, {pool.get()})) {
+                throwParseError(error);
+            }
+        }
+        Document document;
+        document.m_owner = std::move(pool);
+        document.m_root  = std::move(root);
+        return document;
+    }
+}  // namespace parser
+
+namespace parser {
+    /**
+     * @brief 增量解析器的状态：容器栈、下一个期望的 token，以及被块边界截断的 token。
+     */
+    struct PushParser::State {
+        /**
+         * @brief 下一个非空白字符应当是什么。
+         */
+        enum class Expect : uint8_t {
+            Value,         ///< 值
+            FirstElement,  ///< 数组的第一个元素或 ']'
+            FirstMember,   ///< 对象的第一个键或 '}'
+            Key,           ///< 对象的键
+            Colon,         ///< ':'
+            Separator,     ///< ',' 或容器的结束字符
+            Done           ///< 根节点已经结束，只允许空白
+        };
+
+        /**
+         * @brief 被块边界截断的 token 的类型。
+         */
+        enum class Partial : uint8_t {
+            None,    ///< 没有
+            String,  ///< 字符串或键
+            Scalar   ///< 数字或字面量
+        };
+
+        uint8_t        option;                      ///< 解析选项
+        size_t         maxDepth;                    ///< 最大嵌套深度
+        ParseStack     stack;                       ///< DOM 模式下尚未结束的容器
+        ParseError     error;                       ///< 最近一个 token 的解析错误
+        DomBuilder     dom;                         ///< DOM 模式的事件处理器
+        JsonHandler*   handler;                     ///< SAX 模式的事件处理器（DOM 模式为空）
+        ContainerStack containers;                  ///< 尚未结束的容器
+        JsonValue      root;                        ///< DOM 模式的结果
+        Expect         expect     = Expect::Value;  ///< 下一个期望的 token
+        Partial        partial    = Partial::None;  ///< 被截断的 token 的类型
+        bool           escaped    = false;          ///< 被截断的字符串以转义符结尾
+        size_t         skip       = 0;              ///< 被截断的转义序列还需要跳过的字节数
+        bool           stopped    = false;          ///< handler 已经要求停止
+        size_t         offset     = 0;              ///< 当前块在整个输入中的起始位置
+        size_t         tokenStart = 0;              ///< 被截断的 token 在整个输入中的起始位置
+        std::string    pending;                     ///< 被截断的 token 已经到达的部分
+        JsonString     unescaped;                   ///< 含转义字符的字符串的反转义结果
+
+        State(JsonHandler* eventHandler, const ParserOptions& options)
+            : option(static_cast<uint8_t>(options.flags & ~(BORROW_STRINGS | IN_SITU))),
+              maxDepth(options.maxDepth),
+              dom(stack, option, error),
+              handler(eventHandler) {}
+
+        /**
+         * @brief 按模式选择事件处理器后处理一块输入。
+         * @param chunk 输入块。
+         * @param last 是否为输入的结尾（结尾处的数字和字面量不再等待后续输入）
+         * @return handler 要求停止时返回 false。
+         */
+        bool process(std::string_view chunk, bool last) {
+            if (stopped) {
+                return false;
+            }
+            bool result;
+            if (handler != nullptr) {
+                HandlerAdapter adapter(*handler, error);
+                result = process(adapter, chunk, last);
+            } else {
+                result = process(dom, chunk, last);
+            }
+            stopped = !result;
+            return result;
+        }
+
+        template <typename Handler>
+        bool process(Handler& handler, std::string_view chunk, bool last);
+
+        template <typename Handler>
+        bool emitToken(Handler& handler, std::string_view json, size_t position, size_t base);
+
+        template <typename Handler>
+        bool finishString(Handler& handler);
+
+        /**
+         * @brief 查找 token 在块中的结束位置。
+         * @param chunk 输入块。
+         * @param position 查找的起始位置。
+         * @param kind token 的类型。
+         * @param last 是否为输入的结尾。
+         * @return token 之后的位置；token 在块中没有结束时返回 npos。
+         */
+        size_t findTokenEnd(std::string_view chunk, size_t position, Partial kind, bool last) {
+            if (kind == Partial::Scalar) {
+                while (position < chunk.size() && !isScalarEnd(chunk[position])) {
+                    position++;
+                }
+                return position < chunk.size() || last ? position : std::string_view::npos;
+            }
+            if (escaped) {
+                if (position >= chunk.size()) {
+                    return std::string_view::npos;
+                }
+                escaped = false;
+                skip    = escapeLength(chunk[position]);
+            }
+            while (true) {
+                // 跳过转义序列的剩余部分，它可能跨越块边界
+                const size_t step = std::min(skip, chunk.size() - position);
+                position += step;
+                skip -= step;
+                if (skip > 0) {
+                    return std::string_view::npos;
+                }
+                position = simd::findStringSpecial(chunk.data(), chunk.size(), position);
+                if (position >= chunk.size()) {
+                    return std::string_view::npos;
+                }
+                if (chunk[position] != '\\') {
+                    // 结束引号；控制字符同样结束 token，由 scanString 报告错误
+                    return position + 1;
+                }
+                if (position + 1 >= chunk.size()) {
+                    escaped = true;
+                    return std::string_view::npos;
+                }
+                skip = escapeLength(chunk[position + 1]);
+                position++;
+            }
+        }
+
+        /**
+         * @brief 转义符之后属于同一个转义序列的字节数。
+         *
+         * \uXXXX 与 \xHH 的十六进制位即使是引号也属于转义序列：parse 会读取这些字节后再报告错误，
+         * 截断在其中的引号处会使错误类型和位置与 parse 不同（例如 "\u12" 之后的内容）。
+         * @param c 转义符之后的字符。
+         * @return 包括 c 在内需要跳过的字节数。
+         */
+        static size_t escapeLength(char c) noexcept {
+            switch (c) {
+                case 'u': return 5;
+                case 'x': return 3;
+                default: return 1;
+            }
+        }
+
+        /**
+         * @brief 一个值结束后，期望下一个分隔符或文档结束。
+         */
+        void completeValue() {
+            expect = containers.empty() ? Expect::Done : Expect::Separator;
+        }
+
+        /**
+         * @brief 报告值之后出现的非法字符（与 parse 的错误信息相同）
+         * @param position 非法字符在整个输入中的位置。
+         */
+        [[noreturn]] void separatorError(size_t position) const {
+            if (containers.empty()) {
+                throw JsonParseException("Unexpected content after JSON value", position);
+            }
+            if (containers.inObject()) {
+                throw JsonParseException("Expected ',' or '}'", position);
+            }
+            throw JsonParseException("Expected ',' or ']'", position);
+        }
+    };
+
+    /**
+     * @brief 解析一个完整的 token（字符串、键、数字或字面量）并交给 handler。
+     * @param handler 事件处理器。
+     * @param json 以 token 结尾的输入。
+     * @param position token 的起始位置。
+     * @param base json 在整个输入中的起始位置，用于修正错误位置。
+     * @return handler 的返回值。
+     */
+    template <typename Handler>
+    bool PushParser::State::emitToken(Handler&         handler,
+                                      std::string_view json,
+                                      size_t           position,
+                                      size_t           base) {
+        bool result  = true;
+        bool boolean = false;
+        if (expect == Expect::Key) {
+            expect = Expect::Colon;
+            result = emitString<true>(json, position, option, unescaped, handler, error);
+        } else {
+            switch (json[position]) {
+                case '"':
+                    result = emitString<false>(json, position, option, unescaped, handler, error);
+                    break;
+                case 'n': result = parseNull(json, position, error) && handler.null(); break;
+                case 't':
+                case 'f':
+                    result = parseBoolean(json, position, boolean, error) &&
+                             handler.boolean(boolean);
+                    break;
+                default: result = emitNumber(json, position, handler, error); break;
+            }
+        }
+        if (error) {
+            error.offset += base;
+            throwParseError(error);
+        }
+        if (expect == Expect::Colon) {
+            return result;
+        }
+        // 标量必须占据整个 token，例如 "12x"、"nullx" 都是非法的
+        if (position < json.size()) {
+            separatorError(base + position);
+        }
+        completeValue();
+        return result;
+    }
+
+    /**
+     * @brief 输入结束时字符串仍未找到结束位置：与 parse 一样扫描剩余的全部输入。
+     *
+     * 通常这会报告字符串意外结束；但 \x 扩展的转义序列在输入末尾可以提前结束，
+     * 此时字符串在 findTokenEnd 跳过的引号处结束，其后的输入继续按正常流程处理。
+     * @param handler 事件处理器。
+     * @return handler 的返回值。
+     */
+    template <typename Handler>
+    bool PushParser::State::finishString(Handler& handler) {
+        // 字符串的扫描范围必须与 parse 相同（到输入末尾），不能截断在结束引号处
+        const bool key      = expect == Expect::Key;
+        size_t     position = 0;
+        bool       result;
+        if (key) {
+            result = emitString<true>(pending, position, option, unescaped, handler, error);
+        } else {
+            result = emitString<false>(pending, position, option, unescaped, handler, error);
+        }
+        if (error) {
+            error.offset += tokenStart;
+            throwParseError(error);
+        }
+        partial = Partial::None;
+        escaped = false;
+        skip    = 0;
+        if (key) {
+            expect = Expect::Colon;
+        } else {
+            completeValue();
+        }
+        if (!result) {
+            return false;
+        }
+        offset = tokenStart + position;
+        return process(handler, std::string(pending, position), true);
+    }
+
+    template <typename Handler>
+    bool PushParser::State::process(Handler& handler, std::string_view chunk, bool last) {
+        size_t position = 0;
+        // 先补全上一块中被截断的 token
+        if (partial != Partial::None) {
+            const size_t end = findTokenEnd(chunk, 0, partial, last);
+            if (end == std::string_view::npos) {
+                pending.append(chunk);
+                offset += chunk.size();
+                return !last || finishString(handler);
+            }
+            pending.append(chunk.data(), end);
+            partial  = Partial::None;
+            position = end;
+            if (!emitToken(handler, pending, 0, tokenStart)) {
+                return false;
+            }
+        }
+        while (true) {
+            skipUselessChar(chunk, position);
+            if (position >= chunk.size()) {
+                break;
+            }
+            const char c = chunk[position];
+            switch (expect) {
+                case Expect::FirstElement:
+                    if (c == ']') {
+                        position++;
+                        containers.pop();
+                        if (!handler.endArray()) {
+                            return false;
+                        }
+                        completeValue();
+                        continue;
+                    }
+                    [[fallthrough]];
+                case Expect::Value:
+                    if (c == '[' || c == '{') {
+                        if (maxDepth != 0 && containers.depth() >= maxDepth) {
+                            throw JsonParseException("Maximum nesting depth exceeded",
+                                                     offset + position);
+                        }
+                        position++;
+                        containers.push(c == '{');
+                        expect = c == '{' ? Expect::FirstMember : Expect::FirstElement;
+                        if (!(c == '{' ? handler.startObject() : handler.startArray())) {
+                            return false;
+                        }
+                        continue;
+                    }
+                    if (c != '"' && c != '-' && c != 't' && c != 'f' && c != 'n' && !isDigit(c)) {
+                        throw JsonParseException("Unexpected character: " + std::string(1, c),
+                                                 offset + position);
+                    }
+                    break;
+                case Expect::FirstMember:
+                    if (c == '}') {
+                        position++;
+                        containers.pop();
+                        if (!handler.endObject()) {
+                            return false;
+                        }
+                        completeValue();
+                        continue;
+                    }
+                    expect = Expect::Key;
+                    [[fallthrough]];
+                case Expect::Key:
+                    if (c != '"') {
+                        throw JsonParseException("the key of object must be a string",
+                                                 offset + position);
+                    }
+                    break;
+                case Expect::Colon:
+                    if (c != ':') {
+                        throw JsonParseException("Unexpected end of Object", offset + position);
+                    }
+                    position++;
+                    expect = Expect::Value;
+                    continue;
+                case Expect::Separator: {
+                    const bool isObject = containers.inObject();
+                    if (c == ',') {
+                        position++;
+                        expect = isObject ? Expect::Key : Expect::Value;
+                        continue;
+                    }
+                    if (c != (isObject ? '}' : ']')) {
+                        separatorError(offset + position);
+                    }
+                    position++;
+                    containers.pop();
+                    if (!(isObject ? handler.endObject() : handler.endArray())) {
+                        return false;
+                    }
+                    completeValue();
+                    continue;
+                }
+                case Expect::Done:
+                    throw JsonParseException("Unexpected content after JSON value",
+                                             offset + position);
+            }
+            // 字符串、键、数字或字面量：在块中结束时直接解析，否则暂存等待后续输入
+            const Partial kind = c == '"' ? Partial::String : Partial::Scalar;
+            const size_t  end  = findTokenEnd(chunk, position + (c == '"'), kind, last);
+            if (end == std::string_view::npos) {
+                partial    = kind;
+                tokenStart = offset + position;
+                pending.assign(chunk.data() + position, chunk.size() - position);
+                break;
+            }
+            if (!emitToken(handler, chunk.substr(0, end), position, offset)) {
+                return false;
+            }
+            position = end;
+        }
+        offset += chunk.size();
+        return true;
+    }
+
+    PushParser::PushParser(const ParserOptions& options)
+        : m_state(std::make_unique<State>(nullptr, options)) {}
+
+    PushParser::PushParser(JsonHandler& handler, const ParserOptions& options)
+        : m_state(std::make_unique<State>(&handler, options)) {}
+
+    PushParser::~PushParser()                                = default;
+    PushParser::PushParser(PushParser&&) noexcept            = default;
+    PushParser& PushParser::operator=(PushParser&&) noexcept = default;
+
+    bool PushParser::feed(std::string_view chunk) {
+        return m_state->process(chunk, false);
+    }
+
+    bool PushParser::finish() {
+        State& state = *m_state;
+        // 以空块结束输入，输入末尾的数字和字面量在这里完成
+        if (!state.process({}, true)) {
+            return false;
+        }
+        // 与 parse 相同：值或容器内的其余位置分别报告输入、数组或对象意外结束
+        if (state.expect != State::Expect::Done) {
+            if (state.containers.empty() ||
+                (state.expect == State::Expect::Value && state.containers.inObject())) {
+                throw JsonParseException("Unexpected end of input", state.offset);
+            }
+            throw JsonParseException(state.containers.inObject() ? "Unexpected end of Object"
+                                                                 : "Unexpected end of Array",
+                                     state.offset);
+        }
+        if (state.handler == nullptr) {
+            state.root = state.dom.take();
+        }
+        return true;
+    }
+
+    JsonValue& PushParser::root() noexcept {
+        return m_state->root;
+    }
+}  // namespace parser
+
+/**
+ * @brief 跳过一个字符串。
+ * @param json 输入 JSON 字符串。
+ * @param position 开头引号的位置，返回时为结束引号之后的位置（输入输出参数）
+ * @throw JsonParseException 如果字符串没有结束或含有控制字符，抛出异常。
+ */
+static void skipString(const std::string_view& json, size_t& position) {
+    size_t special = simd::findStringSpecial(json.data(), json.size(), position + 1);
+    while (special < json.size()) {
+        const char c = json[special];
+        if (c == '"') {
+            position = special + 1;
+            return;
+        }
+        if (c != '\\') {
+            throw JsonParseException("Control character not allowed in JSON string", special + 1);
+        }
+        special = simd::findStringSpecial(json.data(), json.size(), special + 2);
+    }
+    throw JsonParseException("Unexpected end of string", json.size());
+}
+
+/**
+ * @brief 跳过一个数组或对象（包括其全部子树），不构建也不做完整校验。
+ *
+ * 每次处理 64 个字节：去掉被转义的引号后求前缀异或得到
+ * 字符串内的位图，只统计字符串之外的括号。一块中的右括号少于当前层数时整块跳过，
+ * 否则逐个括号计算层数，找到与开头匹配的右括号。
+ * 只跟踪括号的层次，不检查括号的种类以及逗号、冒号和标量。
+ * @param json 输入 JSON 字符串。
+ * @param position '[' 或 '{' 的位置，返回时为匹配的右括号之后的位置（输入输出参数）
+ * @throw JsonParseException 如果找不到匹配的右括号，抛出异常。
+ */
+static void skipContainer(const std::string_view& json, size_t& position) {
+    simd::EscapeScanner escapeScanner;
+    uint64_t            prevInString = 0;  // 上一块是否在字符串内结束（全 0 或全 1）
+    size_t              depth        = 0;
+    for (size_t base = position; base < json.size(); base += 64) {
+        const size_t remain = json.size() - base;
+        // 不足 64 字节的尾块用空格补齐
+        char        block[64];
+        const char* data = json.data() + base;
+        if (remain < 64) {
+            std::memset(block, ' ', sizeof(block));
+            std::memcpy(block, data, remain);
+            data = block;
+        }
+        const simd::BracketMasks masks    = simd::classifyBrackets(data);
+        const uint64_t           escaped  = escapeScanner.next(masks.backslash);
+        const uint64_t           quote    = masks.quote & ~escaped;
+        const uint64_t           inString = simd::prefixXor(quote) ^ prevInString;
+        prevInString = static_cast<uint64_t>(static_cast<int64_t>(inString) >> 63);
+        const uint64_t open  = masks.open & ~inString;
+        const uint64_t close = masks.close & ~inString;
+        if (depth > static_cast<size_t>(simd::popCount(close))) {
+            depth += simd::popCount(open);
+            depth -= simd::popCount(close);
+            continue;
+        }
+        uint64_t brackets = open | close;
+        while (brackets != 0) {
+            const uint64_t bit = brackets & (0 - brackets);
+            if (open & bit) {
+                depth++;
+            } else if (--depth == 0) {
+                position = base + simd::trailingZeros(bit) + 1;
+                return;
+            }
+            brackets ^= bit;
+        }
+    }
+    throw JsonParseException("Unexpected end of input", json.size());
+}
+
+/**
+ * @brief 跳过一个值（包括其全部子树），不构建也不做完整校验。
+ * @param json 输入 JSON 字符串。
+ * @param position 值的起始位置，返回时为值之后的位置（输入输出参数）
+ * @throw JsonParseException 如果输入提前结束，抛出异常。
+ */
+static void skipValue(const std::string_view& json, size_t& position) {
+    switch (json[position]) {
+        case '"': return skipString(json, position);
+        case '[':
+        case '{': return skipContainer(json, position);
+        default:
+            // 标量跳到下一个分隔符
+            while (position < json.size() && !isScalarEnd(json[position])) {
+                position++;
+            }
+            return;
+    }
+}
+
+/**
+ * @brief 跳过数组元素或对象成员之后的分隔符。
+ * @param json 输入 JSON 字符串。
+ * @param position 元素之后的位置，返回时为下一个元素（或键）的起始位置（输入输出参数）
+ * @param close 容器的结束字符（']' 或 '}'）
+ * @return 还有下一个元素时返回 true，遇到结束字符时返回 false。
+ * @throw JsonParseException 如果既不是 ',' 也不是结束字符，抛出异常。
+ */
+static bool nextElement(const std::string_view& json, size_t& position, char close) {
+    skipUselessChar(json, position);
+    if (position < json.size() && json[position] == ',') {
+        position++;
+        skipUselessChar(json, position);
+        if (position >= json.size()) {
+            throw JsonParseException("Unexpected end of input", position);
+        }
+        return true;
+    }
+    if (position < json.size() && json[position] == close) {
+        return false;
+    }
+    throw JsonParseException(close == ']' ? "Expected ',' or ']'" : "Expected ',' or '}'",
+                             position);
+}
+
+/**
+ * @brief 进入数组或对象，定位到第一个元素（或键）
+ * @param json 输入 JSON 字符串。
+ * @param position '[' 或 '{' 的位置，返回时为第一个元素的起始位置（输入输出参数）
+ * @return 容器为空时返回 false。
+ * @throw JsonParseException 如果输入提前结束，抛出异常。
+ */
+static bool firstElement(const std::string_view& json, size_t& position) {
+    const char close = json[position] == '[' ? ']' : '}';
+    position++;
+    skipUselessChar(json, position);
+    if (position >= json.size()) {
+        throw JsonParseException("Unexpected end of input", position);
+    }
+    return json[position] != close;
+}
+
+namespace parser::ondemand {
+    Document::Document(std::string_view json, const ParserOptions& options)
+        : m_json(json), m_options(options), m_root(0) {
+        m_options.flags &= ~(BORROW_STRINGS | IN_SITU);
+        skipUselessChar(m_json, m_root);
+        if (m_root >= m_json.size()) {
+            throw JsonParseException("Unexpected end of input", m_root);
+        }
+    }
+
+    Value Document::root() const {
+        return Value(this, m_root);
+    }
+
+    Value Document::operator[](std::string_view key) const {
+        return root()[key];
+    }
+
+    Value Document::operator[](size_t index) const {
+        return root()[index];
+    }
+
+    JsonType Value::type() const {
+        const std::string_view json = m_document->m_json;
+        switch (json[m_position]) {
+            case 'n': return JsonType::Null;
+            case 't':
+            case 'f': return JsonType::Boolean;
+            case '"': return JsonType::String;
+            case '[': return JsonType::Array;
+            case '{': return JsonType::Object;
+            case '-':
+            case '0':
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9': {
+                size_t     position = m_position;
+                NumberText number;
+                int64_t    integer = 0;
+                ParseError error;
+                if (!scanNumber(json, position, number, error)) {
+                    throwParseError(error);
+                }
+                return numberToInteger(number, integer) ? JsonType::Integer : JsonType::Double;
+            }
+            default:
+                throw JsonParseException(
+                    "Unexpected character: " + std::string(1, json[m_position]), m_position);
+        }
+    }
+
+    bool Value::isNull() const {
+        return m_document->m_json[m_position] == 'n';
+    }
+
+    /**
+     * @brief 从 position 处的成员开始查找键，直到对象结束或比较完 stop 处的成员。
+     * @param json 输入 JSON 字符串。
+     * @param position 第一个要比较的成员的键的位置，找到时为值的位置（输入输出参数）
+     * @param member 找到时为该成员的键的位置（输出参数）
+     * @param stop 最后一个要比较的成员的键的位置（npos 表示查找到对象结束）
+     * @param key 要查找的键。
+     * @param option 解析选项。
+     * @return 找到时返回 true。
+     * @throw JsonParseException 如果遇到语法错误，抛出异常。
+     */
+    static bool findMember(const std::string_view& json,
+                           size_t&                 position,
+                           size_t&                 member,
+                           size_t                  stop,
+                           std::string_view        key,
+                           uint8_t                 option) {
+        JsonString unescaped;
+        do {
+            member = position;
+            if (json[position] != '"') {
+                throw JsonParseException("the key of object must be a string", position);
+            }
+            std::string_view raw;
+            ParseError       error;
+            unescaped.clear();
+            const StringScan scan = scanString(json, position, option, unescaped, raw, error);
+            if (scan == StringScan::Failed) {
+                throwParseError(error);
+            }
+            const bool match = scan == StringScan::Raw ? raw == key : unescaped == key;
+            skipUselessChar(json, position);
+            if (position >= json.size() || json[position] != ':') {
+                throw JsonParseException("Unexpected end of Object", position);
+            }
+            position++;
+            skipUselessChar(json, position);
+            if (position >= json.size()) {
+                throw JsonParseException("Unexpected end of input", position);
+            }
+            if (match) {
+                return true;
+            }
+            if (member == stop) {
+                return false;
+            }
+            skipValue(json, position);
+        } while (nextElement(json, position, '}'));
+        return false;
+    }
+
+    Value Value::operator[](std::string_view key) const {
+        const std::string_view json     = m_document->m_json;
+        const uint8_t          option   = m_document->m_options.flags;
+        size_t                 position = m_position;
+        if (json[position] != '{') {
+            throw JsonException("Not an Object");
+        }
+        if (!firstElement(json, position)) {
+            throw JsonException("Key not found");
+        }
+        // 先从上一次找到的成员之后继续查找，找不到再从头查找到该成员为止（包括该成员）
+        Document::Cursor& cursor = m_document->m_object;
+        const size_t      first  = position;
+        size_t            stop   = std::string_view::npos;
+        size_t            member = 0;
+        bool              found  = false;
+        if (cursor.container == m_position) {
+            // 上一次只记录了成员的位置，到这里才跳过它的值
+            stop     = cursor.index;
+            position = cursor.position;
+            skipValue(json, position);
+            found = nextElement(json, position, '}') &&
+                    findMember(json, position, member, std::string_view::npos, key, option);
+        }
+        if (!found) {
+            position = first;
+            found    = findMember(json, position, member, stop, key, option);
+        }
+        if (!found) {
+            throw JsonException("Key not found");
+        }
+        cursor = {m_position, member, position};
+        return Value(m_document, position);
+    }
 
-                        // 编码 Unicode 码点 → \uXXXX or \uXXXX\uXXXX (代理对)
-                        if (codePoint <= 0xFFFF) {
-                            // 基本平面（BMP）
-                            char buffer[7];
-                            snprintf(buffer, sizeof(buffer), "\\u%04X", codePoint);
-                            result += buffer;
-                        } else {
-                            // 补充平面（Surrogate Pair）
-                            codePoint -= 0x10000;
-                            auto highSurrogate = static_cast<uint16_t>((codePoint >> 10) + 0xD800);
-                            auto lowSurrogate = static_cast<uint16_t>((codePoint & 0x3FF) + 0xDC00);
-                            char buffer[7];
-                            snprintf(buffer, sizeof(buffer), "\\u%04X", highSurrogate);
-                            result += buffer;
-                            snprintf(buffer, sizeof(buffer), "\\u%04X", lowSurrogate);
-                            result += buffer;
-                        }
-                    } else {
-                        throw JsonParseException("not support parse x escape sequence", position);
+    Value Value::operator[](size_t index) const {
+        const std::string_view json     = m_document->m_json;
+        size_t                 position = m_position;
+        if (json[position] != '[') {
+            throw JsonException("Not an Array");
+        }
+        if (!firstElement(json, position)) {
+            throw JsonException("Array index out of range");
+        }
+        // 访问的下标不小于上一次时从上一次的元素继续
+        Document::Cursor& cursor  = m_document->m_array;
+        size_t            current = 0;
+        if (cursor.container == m_position && cursor.index <= index) {
+            current  = cursor.index;
+            position = cursor.position;
+        }
+        while (current < index) {
+            skipValue(json, position);
+            if (!nextElement(json, position, ']')) {
+                throw JsonException("Array index out of range");
+            }
+            current++;
+        }
+        cursor = {m_position, index, position};
+        return Value(m_document, position);
+    }
+
+    size_t Value::size() const {
+        const std::string_view json     = m_document->m_json;
+        size_t                 position = m_position;
+        const char             open     = json[position];
+        if (open != '[' && open != '{') {
+            throw JsonException("Not an Array or Object");
+        }
+        size_t count = 0;
+        if (firstElement(json, position)) {
+            do {
+                if (open == '{') {
+                    // 跳过键和冒号
+                    skipValue(json, position);
+                    skipUselessChar(json, position);
+                    if (position >= json.size() || json[position] != ':') {
+                        throw JsonParseException("Unexpected end of Object", position);
                     }
-                    break;
-                }
-                case '0': {
-                    if (option & parser::ENABLE_PARSE_0_ESCAPE_SEQUENCE) {
-                        // \0 转为 \u0000
-                        result += "\\u0000";
-                    } else {
-                        throw JsonParseException("Invalid \\0 escape sequence", position);
+                    position++;
+                    skipUselessChar(json, position);
+                    if (position >= json.size()) {
+                        throw JsonParseException("Unexpected end of input", position);
                     }
-                    break;
                 }
-                default: throw JsonParseException("Invalid escape sequence", position);
-            }
-        } else if (static_cast<unsigned char>(c) < 0x20) {
-            throw JsonParseException("Control character not allowed in JSON string", position);
+                skipValue(json, position);
+                count++;
+            } while (nextElement(json, position, open == '[' ? ']' : '}'));
+        }
+        return count;
+    }
+
+    Value::ArrayIterator Value::begin() const {
+        const std::string_view json     = m_document->m_json;
+        size_t                 position = m_position;
+        if (json[position] != '[') {
+            throw JsonException("Not an Array");
+        }
+        if (!firstElement(json, position)) {
+            return end();
+        }
+        return ArrayIterator(m_document, position);
+    }
+
+    Value::ArrayIterator& Value::ArrayIterator::operator++() {
+        const std::string_view json = m_document->m_json;
+        skipValue(json, m_position);
+        if (!nextElement(json, m_position, ']')) {
+            m_position = std::string_view::npos;
+        }
+        return *this;
+    }
+
+    JsonValue Value::materialize(bool borrow) const {
+        size_t    position = m_position;
+        uint8_t   option   = m_document->m_options.flags | (borrow ? BORROW_STRINGS : 0);
+        JsonValue value =
+            parseValue(m_document->m_json, position, option, m_document->m_options.maxDepth);
+        checkEnd(position);
+        return value;
+    }
+
+    void Value::checkEnd(size_t position) const {
+        if (m_position != m_document->m_root) {
+            return;
+        }
+        // 根节点之后只允许空白字符，与 parser::parse 相同
+        const std::string_view json = m_document->m_json;
+        skipUselessChar(json, position);
+        if (position != json.size()) {
+            throw JsonParseException("Unexpected content after JSON value", position);
+        }
+    }
+
+    std::string_view Value::stringView() const {
+        const std::string_view json = m_document->m_json;
+        if (json[m_position] != '"') {
+            throw JsonException("Cannot convert to string");
+        }
+        size_t           position = m_position;
+        JsonString       unescaped;
+        std::string_view raw;
+        ParseError       error;
+        const StringScan scan =
+            scanString(json, position, m_document->m_options.flags, unescaped, raw, error);
+        if (scan == StringScan::Failed) {
+            throwParseError(error);
+        }
+        checkEnd(position);
+        if (scan == StringScan::Raw) {
+            return raw;
+        }
+        return m_document->m_strings.emplace_back(std::move(unescaped));
+    }
+}  // namespace parser::ondemand
+
+/**
+ * @brief 并行解析的上下文。
+ */
+struct ParallelContext {
+    std::string_view         json;       ///< 输入
+    std::vector<std::string> path;       ///< 要并行解析的数组的路径（已经拆分并反转义）
+    uint8_t                  option;     ///< 解析选项
+    size_t                   maxDepth;   ///< 最大嵌套深度，0 表示不限制
+    size_t                   threads;    ///< 解析线程数
+    size_t                   sliceSize;  ///< 每片至少包含的输入字节数
+};
+
+/**
+ * @brief 数组中连续的若干个元素，是并行解析的最小单位。
+ */
+struct ArraySlice {
+    size_t begin = 0;  ///< 第一个元素的起始位置
+    size_t count = 0;  ///< 元素个数
+    size_t end   = 0;  ///< 最后一个元素之后的 ',' 或 ']' 的位置
+};
+
+/**
+ * @brief 把 JSON Pointer（RFC 6901）拆分为反转义后的各级引用。
+ * @param pointer JSON Pointer，空字符串表示根节点。
+ * @return 各级引用。
+ * @exception JsonException 如果 pointer 格式无效，抛出异常。
+ */
+static std::vector<std::string> splitJsonPointer(std::string_view pointer) {
+    std::vector<std::string> tokens;
+    if (pointer.empty()) {
+        return tokens;
+    }
+    if (pointer[0] != '/') {
+        throw JsonException("Invalid JSON Pointer: " + std::string(pointer));
+    }
+    for (size_t i = 0; i < pointer.size(); ++i) {
+        if (pointer[i] == '/') {
+            tokens.emplace_back();
+        } else if (pointer[i] != '~') {
+            tokens.back() += pointer[i];
+        } else if (i + 1 < pointer.size() && (pointer[i + 1] == '0' || pointer[i + 1] == '1')) {
+            tokens.back() += pointer[++i] == '0' ? '~' : '/';
         } else {
-            result.push_back(c);
+            throw JsonException("Invalid JSON Pointer: " + std::string(pointer));
+        }
+    }
+    return tokens;
+}
+
+/**
+ * @brief 把 JSON Pointer 中的一级引用解释为数组下标。
+ * @param token 一级引用。
+ * @param index 数组下标（输出参数）
+ * @return token 是合法的数组下标（不含前导零的十进制数）时返回 true。
+ */
+static bool pointerIndex(const std::string& token, size_t& index) {
+    if (token.empty() || token.size() > 18 || (token[0] == '0' && token.size() > 1)) {
+        return false;
+    }
+    index = 0;
+    for (char c : token) {
+        if (!isDigit(c)) {
+            return false;
+        }
+        index = index * 10 + static_cast<size_t>(c - '0');
+    }
+    return true;
+}
+
+/**
+ * @brief 解析位于 depth 层容器之内的值，嵌套深度按整个文档计算。
+ * @param json 输入 JSON 字符串。
+ * @param position 值的起始位置，返回时为值之后的位置（输入输出参数）
+ * @param option 解析选项。
+ * @param maxDepth 整个文档的最大嵌套深度，0 表示不限制。
+ * @param depth 外层容器的个数。
+ * @return 解析结果。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonValue parseNestedValue(const std::string_view& json,
+                                  size_t&                 position,
+                                  uint8_t                 option,
+                                  size_t                  maxDepth,
+                                  size_t                  depth) {
+    if (maxDepth == 0) {
+        return parseValue(json, position, option, 0);
+    }
+    if (depth >= maxDepth) {
+        // 已经没有剩余的层数，只允许标量
+        const char c = json[position];
+        if (c == '[' || c == '{') {
+            throw JsonParseException("Maximum nesting depth exceeded", position);
         }
+        return parseValue(json, position, option, 0);
     }
-    // 异常
-    throw JsonParseException("Unexpected end of string", position);
+    return parseValue(json, position, option, maxDepth - depth);
+}
+
+/**
+ * @brief 解析位于 depth 层容器之内的值（并行解析使用）
+ * @param context 并行解析的上下文。
+ * @param position 值的起始位置，返回时为值之后的位置（输入输出参数）
+ * @param depth 外层容器的个数。
+ * @return 解析结果。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonValue parseNestedValue(const ParallelContext& context, size_t& position, size_t depth) {
+    return parseNestedValue(context.json, position, context.option, context.maxDepth, depth);
 }
 
-JsonValue parseArray(const std::string_view& json, size_t& position, uint8_t option) {
-    // 当前字符一定为[
-    JsonArray result;
-    // 跳过[
+/**
+ * @brief 读取对象成员的键以及之后的 ':'，定位到成员的值。
+ * @param json 输入 JSON 字符串。
+ * @param position 键的起始位置，返回时为值的起始位置（输入输出参数）
+ * @param option 解析选项。
+ * @param unescaped 键含有转义字符时存放反转义结果。
+ * @return 键的内容（引用输入或 unescaped）
+ * @throw JsonParseException 如果键或分隔符无效，抛出异常。
+ */
+static std::string_view readMemberKey(const std::string_view& json,
+                                      size_t&                 position,
+                                      uint8_t                 option,
+                                      JsonString&             unescaped) {
+    if (json[position] != '"') {
+        throw JsonParseException("the key of object must be a string", position);
+    }
+    std::string_view raw;
+    ParseError       error;
+    unescaped.clear();
+    const StringScan scan = scanString(json, position, option, unescaped, raw, error);
+    if (scan == StringScan::Failed) {
+        throwParseError(error);
+    }
+    skipUselessChar(json, position);
+    if (position >= json.size() || json[position] != ':') {
+        throw JsonParseException("Expected ':'", position);
+    }
     position++;
-    // 跳过无用字符串
-    SKIP_USELESS_CHAR(json, position);
+    skipUselessChar(json, position);
     if (position >= json.size()) {
-        throw JsonParseException("Unexpected end of Array", position);
+        throw JsonParseException("Unexpected end of input", position);
     }
-    // 如果遇到了]
-    if (json[position] == ']') {
-        position++;
-        return result;
+    return scan == StringScan::Raw ? raw : std::string_view(unescaped);
+}
+
+/**
+ * @brief 解析一片数组元素。
+ * @param context 并行解析的上下文。
+ * @param slice 要解析的元素。
+ * @param depth 元素外层容器的个数（包括数组本身）
+ * @return 解析出的元素。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonArray parseArraySlice(const ParallelContext& context,
+                                 const ArraySlice&      slice,
+                                 size_t                 depth) {
+    JsonArray elements;
+    elements.reserve(slice.count);
+    size_t position = slice.begin;
+    for (size_t i = 0; i < slice.count; ++i) {
+        elements.emplace_back(parseNestedValue(context, position, depth));
+        if (i + 1 < slice.count && !nextElement(context.json, position, ']')) {
+            throw JsonParseException("Expected ',' or ']'", position);
+        }
     }
-    // 解析后面的 value
-    while (position < json.size()) {
-        // 跳过无用字符
-        SKIP_USELESS_CHAR(json, position);
-        // 解析值
-        result.emplace_back(parseValue(json, position, option));
-        // 无用字符
-        SKIP_USELESS_CHAR(json, position);
-        if (position >= json.size()) {
-            break;
+    // 预扫描只按分隔符划分标量，最后一个元素必须恰好在片的结束位置之前结束
+    skipUselessChar(context.json, position);
+    if (position != slice.end) {
+        throw JsonParseException("Expected ',' or ']'", position);
+    }
+    return elements;
+}
+
+/**
+ * @brief 并行解析一个数组。
+ *
+ * 调用线程先跳过式扫描整个数组，每隔 sliceSize 字节在元素边界处切出一片；
+ * 各线程再从共享的计数器中领取下一片解析，先完成的线程自动多分担剩余的片，
+ * 最后按顺序把各片的元素移动到结果数组中。
+ * @param context 并行解析的上下文。
+ * @param position '[' 的位置，返回时为 ']' 之后的位置（输入输出参数）
+ * @param depth 数组外层容器的个数。
+ * @return 解析出的数组。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonValue parseArrayParallel(const ParallelContext& context,
+                                    size_t&                position,
+                                    size_t                 depth) {
+    const std::string_view json = context.json;
+    if (context.maxDepth != 0 && depth >= context.maxDepth) {
+        throw JsonParseException("Maximum nesting depth exceeded", position);
+    }
+    // 按数组之后的全部输入估计片的大小，保证每个线程能分到多片
+    const size_t sliceSize = std::max(context.sliceSize,
+                                      (json.size() - position) / (context.threads * 8));
+    std::vector<ArraySlice> slices;
+    if (firstElement(json, position)) {
+        ArraySlice slice{position, 0, 0};
+        bool       more = true;
+        while (more) {
+            skipValue(json, position);
+            skipUselessChar(json, position);
+            slice.count++;
+            slice.end = position;
+            more      = nextElement(json, position, ']');
+            if (!more || position - slice.begin >= sliceSize) {
+                slices.push_back(slice);
+                slice = {position, 0, 0};
+            }
         }
-        // 如果遇到了]
-        if (json[position] == ']') {
-            position++;
-            return result;
+    }
+    position++;
+
+    std::vector<JsonArray>          results(slices.size());
+    std::vector<std::exception_ptr> errors(slices.size());
+    std::atomic<size_t>             next{0};
+    auto                            work = [&] {
+        for (size_t i = next++; i < slices.size(); i = next++) {
+            try {
+                results[i] = parseArraySlice(context, slices[i], depth + 1);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
         }
-        // 如果不是]那就必须为
-        if (json[position] != ',') {
-            throw JsonParseException("Expected ',' or ']'", position);
+    };
+    std::vector<std::thread> workers;
+    const size_t             threads = std::min(context.threads, slices.size());
+    for (size_t i = 1; i < threads; ++i) {
+        try {
+            workers.emplace_back(work);
+        } catch (const std::system_error&) {
+            // 无法创建更多线程时由已有的线程完成剩余的片
+            break;
         }
-        position++;
     }
-    throw JsonParseException("Unexpected end of Array", position);
+    work();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < slices.size(); ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        count += results[i].size();
+    }
+    JsonArray array;
+    array.reserve(count);
+    for (auto& elements : results) {
+        array.insert(array.end(),
+                     std::make_move_iterator(elements.begin()),
+                     std::make_move_iterator(elements.end()));
+    }
+    return JsonValue(std::move(array));
 }
 
-JsonValue parseObject(const std::string_view& json, size_t& position, uint8_t option) {
-    // 当前字符一定为{
+/**
+ * @brief 沿着路径解析值：路径上的容器逐个成员解析，路径终点的数组并行解析。
+ * @param context 并行解析的上下文。
+ * @param position 值的起始位置，返回时为值之后的位置（输入输出参数）
+ * @param depth 值外层容器的个数，也是路径中已经匹配的层数。
+ * @return 解析结果。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static JsonValue parsePath(const ParallelContext& context, size_t& position, size_t depth) {
+    const std::string_view json = context.json;
+    const char             c    = json[position];
+    if (depth == context.path.size()) {
+        return c == '[' ? parseArrayParallel(context, position, depth)
+                        : parseNestedValue(context, position, depth);
+    }
+    size_t index = 0;
+    if ((c != '{' && c != '[') || (c == '[' && !pointerIndex(context.path[depth], index))) {
+        // 路径不存在，其余部分正常解析
+        return parseNestedValue(context, position, depth);
+    }
+    if (context.maxDepth != 0 && depth >= context.maxDepth) {
+        throw JsonParseException("Maximum nesting depth exceeded", position);
+    }
+    const char close = c == '[' ? ']' : '}';
+    JsonArray  array;
     JsonObject object;
+    bool       more = firstElement(json, position);
+    while (more) {
+        if (close == ']') {
+            const bool onPath = array.size() == index;
+            array.emplace_back(onPath ? parsePath(context, position, depth + 1)
+                                      : parseNestedValue(context, position, depth + 1));
+        } else {
+            JsonString    unescaped;
+            JsonObjectKey key(readMemberKey(json, position, context.option, unescaped));
+            // 键重复时保留第一次出现的值，与 parse 相同
+            const bool onPath = key == context.path[depth] && object.find(key) == object.end();
+            JsonValue  value  = onPath ? parsePath(context, position, depth + 1)
+                                       : parseNestedValue(context, position, depth + 1);
+            object.try_emplace(std::move(key), std::move(value));
+        }
+        more = nextElement(json, position, close);
+    }
     position++;
-    // 跳过无用字符
-    SKIP_USELESS_CHAR(json, position);
-    // 范围检测
-    if (position >= json.size()) {
-        throw JsonParseException("Unexpected end of Object", position);
+    if (close == ']') {
+        return JsonValue(std::move(array));
     }
-    // 是否已经结束
-    if (json[position] == '}') {
-        position++;
-        return object;
+    return JsonValue(std::move(object));
+}
+
+namespace parser {
+    JsonValue parseParallel(std::string_view json, const ParallelOptions& options) {
+        auto flags = static_cast<uint8_t>(options.parser.flags & ~(BORROW_STRINGS | IN_SITU));
+        ParallelContext context;
+        context.json      = json;
+        context.path      = splitJsonPointer(options.arrayPath);
+        context.option    = flags;
+        context.maxDepth  = options.parser.maxDepth;
+        context.threads   = options.threads;
+        context.sliceSize = std::max<size_t>(options.sliceSize, 1);
+        if (context.threads == 0) {
+            context.threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        try {
+            size_t position = 0;
+            skipUselessChar(json, position);
+            if (position < json.size()) {
+                JsonValue result = parsePath(context, position, 0);
+                skipUselessChar(json, position);
+                if (position == json.size()) {
+                    return result;
+                }
+            }
+        } catch (const JsonParseException&) {
+            // 跳过式扫描不做完整校验，各片也可能以任意顺序出错，统一交给串行解析器报告
+        }
+        // 输入有错误：串行解析给出与 parse 相同的异常
+        return parseDocumentRoot(json, context.option, context.maxDepth);
     }
-    // 说明存在值
-    while (position < json.size()) {
-        SKIP_USELESS_CHAR(json, position);
-        // 解析key
-        if (position < json.size() && json[position] != '"') {
-            throw JsonParseException("the key of object must be a string", position);
-        }
-        JsonValue key = parseString(json, position, option);
-        SKIP_USELESS_CHAR(json, position);
-        // 是否超范围,或者是否没有:
-        if (position >= json.size() || json[position] != ':') {
-            break;
+}  // namespace parser
+
+namespace parser {
+    Projection::Projection(std::initializer_list<std::string_view> paths) : m_nodes(1) {
+        for (std::string_view path : paths) {
+            add(path);
         }
-        position++;
-        // 准备解析值
-        JsonValue value = parseValue(json, position, option);
-        if (position >= json.size()) {
-            break;
+    }
+
+    Projection::Projection(const std::vector<std::string>& paths) : m_nodes(1) {
+        for (const std::string& path : paths) {
+            add(path);
         }
-        object.emplace(key.asString(), value);
-        SKIP_USELESS_CHAR(json, position);
-        // 如果遇到了}
-        if (json[position] == '}') {
-            position++;
-            return object;
+    }
+
+    void Projection::add(std::string_view path) {
+        size_t node = 0;
+        for (std::string& token : splitJsonPointer(path)) {
+            if (m_nodes[node].selected) {
+                // 较短的路径已经选中整个子树
+                return;
+            }
+            size_t next = 0;
+            for (size_t child : m_nodes[node].children) {
+                if (m_nodes[child].token == token) {
+                    next = child;
+                    break;
+                }
+            }
+            if (next == 0) {
+                next = m_nodes.size();
+                m_nodes.push_back({std::move(token), false, {}});
+                m_nodes[node].children.push_back(next);
+            }
+            node = next;
         }
-        // 如果不是]那就必须为
-        if (json[position] != ',') {
-            throw JsonParseException("Expected ',' or ']'", position);
+        m_nodes[node].selected = true;
+        m_nodes[node].children.clear();
+    }
+}  // namespace parser
+
+/**
+ * @brief 投影解析的上下文。
+ */
+struct ProjectionContext {
+    std::string_view                             json;      ///< 输入
+    const std::vector<parser::Projection::Node>& nodes;     ///< 路径树
+    uint8_t                                      option;    ///< 解析选项
+    size_t                                       maxDepth;  ///< 最大嵌套深度，0 表示不限制
+};
+
+/**
+ * @brief 找出与一个数组元素或对象成员匹配的路径节点。
+ * @param context 投影解析的上下文。
+ * @param nodes 当前容器对应的路径节点。
+ * @param matches 匹配的子节点（输出参数）
+ * @param key 对象成员的键。
+ * @param index 数组元素的下标（isArray 为 true 时使用）
+ * @param isArray 是否为数组元素。
+ */
+static void matchProjection(const ProjectionContext&   context,
+                            const std::vector<size_t>& nodes,
+                            std::vector<size_t>&       matches,
+                            std::string_view           key,
+                            size_t                     index,
+                            bool                       isArray) {
+    matches.clear();
+    for (size_t node : nodes) {
+        for (size_t child : context.nodes[node].children) {
+            const std::string& token = context.nodes[child].token;
+            size_t             tokenIndex;
+            if (token == "*" ||
+                (isArray ? pointerIndex(token, tokenIndex) && tokenIndex == index : token == key)) {
+                matches.push_back(child);
+            }
         }
-        position++;
     }
-    throw JsonParseException("Unexpected end of Object", position);
+}
+
+/**
+ * @brief 按投影解析一个值：选中的子树完整解析，路径上的容器逐个成员匹配，其余部分跳过。
+ * @param context 投影解析的上下文。
+ * @param position 值的起始位置，返回时为值之后的位置（输入输出参数）
+ * @param nodes 与该值匹配的路径节点（不能为空）
+ * @param depth 值外层容器的个数。
+ * @param result 投影结果（输出参数）
+ * @return 值位于路径上时返回 true；值是标量而路径还没有结束时返回 false，值被跳过。
+ * @throw JsonParseException 如果解析失败，抛出异常。
+ */
+static bool parseProjectedValue(const ProjectionContext&   context,
+                                size_t&                    position,
+                                const std::vector<size_t>& nodes,
+                                size_t                     depth,
+                                JsonValue&                 result) {
+    const std::string_view json = context.json;
+    for (size_t node : nodes) {
+        if (context.nodes[node].selected) {
+            result = parseNestedValue(json, position, context.option, context.maxDepth, depth);
+            return true;
+        }
+    }
+    const char c = json[position];
+    if (c != '{' && c != '[') {
+        skipValue(json, position);
+        return false;
+    }
+    if (context.maxDepth != 0 && depth >= context.maxDepth) {
+        throw JsonParseException("Maximum nesting depth exceeded", position);
+    }
+    const char          close = c == '[' ? ']' : '}';
+    JsonArray           array;
+    JsonObject          object;
+    JsonObject          claimed;  // 第一次出现时是标量、没有进入结果的键
+    JsonString          unescaped;
+    std::vector<size_t> matches;
+    bool                more = firstElement(json, position);
+    while (more) {
+        if (close == ']') {
+            JsonValue& element = array.emplace_back();
+            matchProjection(context, nodes, matches, {}, array.size() - 1, true);
+            if (matches.empty()) {
+                skipValue(json, position);
+            } else {
+                parseProjectedValue(context, position, matches, depth + 1, element);
+            }
+        } else {
+            const std::string_view key = readMemberKey(json, position, context.option, unescaped);
+            matchProjection(context, nodes, matches, key, 0, false);
+            // 键重复时保留第一次出现的值，与 parse 相同；第一次出现的值是标量而被跳过时，
+            // 该键同样已被占用，后面重复的键不会被解析
+            JsonValue value;
+            if (matches.empty() || object.find(key) != object.end() ||
+                (!claimed.empty() && claimed.find(key) != claimed.end())) {
+                skipValue(json, position);
+            } else if (parseProjectedValue(context, position, matches, depth + 1, value)) {
+                object.try_emplace(JsonObjectKey(key), std::move(value));
+            } else {
+                claimed.try_emplace(JsonObjectKey(key));
+            }
+        }
+        more = nextElement(json, position, close);
+    }
+    position++;
+    result = close == ']' ? JsonValue(std::move(array)) : JsonValue(std::move(object));
+    return true;
 }
 
 namespace parser {
-    JsonValue parse(std::string_view json, ParserOption option) {
-        size_t    position = 0;
-        JsonValue result   = parseValue(json, position, option);
-        SKIP_USELESS_CHAR(json, position);
-        // 按道理现在应该不存在json数据了
+    JsonValue parseProjected(std::string_view     json,
+                             const Projection&    projection,
+                             const ParserOptions& options) {
+        auto flags = static_cast<uint8_t>(options.flags & ~(BORROW_STRINGS | IN_SITU));
+        if (projection.nodes()[0].selected) {
+            // 选中了根节点（空路径）
+            return parseDocumentRoot(json, flags, options.maxDepth);
+        }
+        ProjectionContext context{json, projection.nodes(), flags, options.maxDepth};
+        size_t            position = 0;
+        skipUselessChar(json, position);
+        if (position >= json.size()) {
+            throw JsonParseException("Unexpected end of input", position);
+        }
+        JsonValue result;
+        parseProjectedValue(context, position, {0}, 0, result);
+        skipUselessChar(json, position);
         if (position != json.size()) {
             throw JsonParseException("Unexpected content after JSON value", position);
         }
@@ -704,7 +3563,28 @@ namespace parser {
     }
 }  // namespace parser
 
-#undef SKIP_USELESS_CHAR
+double parseDouble(std::string_view str) {
+    if (str.empty()) {
+        throw JsonParseException("Unexpected end of input", 0);
+    }
+    if (str[0] != '-' && !isDigit(str[0])) {
+        throw JsonParseException("Unexpected character: " + std::string(1, str[0]), 0);
+    }
+    size_t     position = 0;
+    NumberText number;
+    ParseError error;
+    double     value = 0.0;
+    if (!scanNumber(str, position, number, error)) {
+        throwParseError(error);
+    }
+    if (position != str.size()) {
+        throw JsonParseException("Unexpected content after number", position);
+    }
+    if (!numberToDouble(str, 0, position, number, value, error)) {
+        throwParseError(error);
+    }
+    return value;
+}
 
 /**
  * @brief 序列化 JSON 值到输出流。
@@ -749,36 +3629,79 @@ inline static void stringifyDouble(const JsonValue& value, std::ostringstream& o
  * @param value 字符串值。
  * @param oss 输出字符串流。
  */
-static void stringifyString(const std::string& value, std::ostringstream& oss);
-
-/**
- * @brief 序列化数组到输出流。
- * @param value JSON 值（数组）
- * @param oss 输出字符串流。
- * @param indent 缩进空格数。
- * @param level 当前缩进层级。
- */
-static void stringifyArray(const JsonValue& value, std::ostringstream& oss, int indent, int level);
+static void stringifyString(std::string_view value, std::ostringstream& oss);
 
 /**
- * @brief 序列化对象到输出流。
- * @param value JSON 值（对象）
- * @param oss 输出字符串流。
- * @param indent 缩进空格数。
- * @param level 当前缩进层级。
+ * @struct StringifyFrame
+ * @brief 序列化栈中的一层：正在输出的数组或对象，以及下一个要输出的成员。
  */
-static void stringifyObject(const JsonValue& value, std::ostringstream& oss, int indent, int level);
+struct StringifyFrame {
+    const JsonValue* container;  ///< 数组或对象
+    size_t           next;       ///< 下一个成员的下标
+};
 
 void stringifyValue(const JsonValue& value, std::ostringstream& oss, int indent, int level) {
-    // 根据类型调用不同的stringify
-    switch (value.type()) {
-        case JsonType::Null: return stringifyNull(oss);
-        case JsonType::Boolean: return stringifyBoolean(value, oss);
-        case JsonType::Integer: return stringifyInteger(value, oss);
-        case JsonType::Double: return stringifyDouble(value, oss);
-        case JsonType::String: return stringifyString(value.asString(), oss);
-        case JsonType::Array: return stringifyArray(value, oss, indent, level);
-        case JsonType::Object: return stringifyObject(value, oss, indent, level);
+    // 用显式栈代替递归，序列化任意深度的值都不会栈溢出
+    std::vector<StringifyFrame> stack;
+    const JsonValue*            current = &value;
+    while (current != nullptr) {
+        switch (current->type()) {
+            case JsonType::Null: stringifyNull(oss); break;
+            case JsonType::Boolean: stringifyBoolean(*current, oss); break;
+            case JsonType::Integer: stringifyInteger(*current, oss); break;
+            case JsonType::Double: stringifyDouble(*current, oss); break;
+            case JsonType::String: stringifyString(current->asStringView(), oss); break;
+            case JsonType::Array:
+                if (current->asArray().empty()) {
+                    oss << "[]";
+                } else {
+                    oss << '[';
+                    stack.push_back({current, 0});
+                }
+                break;
+            case JsonType::Object:
+                if (current->asObject().empty()) {
+                    oss << "{}";
+                } else {
+                    oss << '{';
+                    stack.push_back({current, 0});
+                }
+                break;
+        }
+        // 取栈顶容器的下一个成员；成员全部输出后输出闭括号并出栈
+        current = nullptr;
+        while (current == nullptr && !stack.empty()) {
+            StringifyFrame& frame   = stack.back();
+            const bool      isArray = frame.container->isArray();
+            const size_t    size    = isArray ? frame.container->asArray().size()
+                                              : frame.container->asObject().size();
+            const int       depth   = level + static_cast<int>(stack.size());
+            if (frame.next == size) {
+                if (indent != 0) {
+                    oss << '\n' << std::string((depth - 1) * indent, ' ');
+                }
+                oss << (isArray ? ']' : '}');
+                stack.pop_back();
+                continue;
+            }
+            if (frame.next > 0) {
+                oss << ',';
+            }
+            if (indent != 0) {
+                oss << '\n';
+            }
+            oss << std::string(depth * indent, ' ');
+            if (isArray) {
+                current = &frame.container->asArray()[frame.next];
+            } else {
+                const auto& member = *(frame.container->asObject().begin() +
+                                       static_cast<std::ptrdiff_t>(frame.next));
+                stringifyString(member.first.view(), oss);
+                oss << ':';
+                current = &member.second;
+            }
+            ++frame.next;
+        }
     }
 }
 
@@ -791,10 +3714,19 @@ void stringifyBoolean(const JsonValue& value, std::ostringstream& oss) {
 }
 
 void stringifyInteger(const JsonValue& value, std::ostringstream& oss) {
+    // 保留了原始文本的数字原样输出
+    if (std::string_view raw = value.rawNumber(); !raw.empty()) {
+        oss << raw;
+        return;
+    }
     oss << value.get<int64_t>();
 }
 
 void stringifyDouble(const JsonValue& value, std::ostringstream& oss) {
+    if (std::string_view raw = value.rawNumber(); !raw.empty()) {
+        oss << raw;
+        return;
+    }
     auto num = value.get<double>();
     if (std::isfinite(num)) {
         std::ostringstream vss;
@@ -855,7 +3787,7 @@ void stringifyDouble(const JsonValue& value, std::ostringstream& oss) {
     }
 }
 
-void stringifyString(const std::string& value, std::ostringstream& oss) {
+void stringifyString(std::string_view value, std::ostringstream& oss) {
     oss << '"';
     for (char c : value) {
         switch (c) {
@@ -872,56 +3804,6 @@ void stringifyString(const std::string& value, std::ostringstream& oss) {
     oss << '"';
 }
 
-void stringifyArray(const JsonValue& value, std::ostringstream& oss, int indent, int level) {
-    const auto& array = value.asArray();
-    if (array.empty()) {
-        oss << "[]";
-        return;
-    }
-    oss << '[';
-    for (size_t i = 0; i < array.size(); i++) {
-        if (i > 0) {
-            oss << ',';
-        }
-        if (indent != 0) {
-            oss << '\n';
-        }
-        oss << std::string((level + 1) * indent, ' ');
-        stringifyValue(array[i], oss, indent, level + 1);
-    }
-    if (indent != 0) {
-        oss << '\n' << std::string(level * indent, ' ');
-    }
-    oss << ']';
-}
-
-void stringifyObject(const JsonValue& value, std::ostringstream& oss, int indent, int level) {
-    const auto& object = value.asObject();
-    if (object.empty()) {
-        oss << "{}";
-        return;
-    }
-    oss << '{';
-    bool first = true;
-    for (const auto& [k, v] : object) {
-        if (!first) {
-            oss << ',';
-        }
-        if (indent != 0) {
-            oss << '\n';
-        }
-        oss << std::string((level + 1) * indent, ' ');
-        first = false;
-        stringifyString(k, oss);
-        oss << ':';
-        stringifyValue(v, oss, indent, level + 1);
-    }
-    if (indent != 0) {
-        oss << '\n' << std::string(level * indent, ' ');
-    }
-    oss << '}';
-}
-
 namespace parser {
     std::string stringify(const JsonValue& value, int indent) {
         std::ostringstream oss;
@@ -0,0 +1,147 @@
+#include "ccjson.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ccjson::parser {
+    /**
+     * @brief 只读的文件内存映射。
+     */
+    class FileMapping {
+      public:
+        /**
+         * @brief 映射整个文件。
+         * @param path 文件路径。
+         * @exception JsonException 如果无法打开或映射文件，抛出异常。
+         */
+        explicit FileMapping(const std::string& path) {
+#if defined(_WIN32)
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                throw JsonException("Failed to open file: " + path);
+            }
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size)) {
+                CloseHandle(file);
+                throw JsonException("Failed to get file size: " + path);
+            }
+            m_size = static_cast<size_t>(size.QuadPart);
+            // 空文件不能映射
+            if (m_size != 0) {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping != nullptr) {
+                    m_data = static_cast<const char*>(
+                        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    CloseHandle(mapping);
+                }
+            }
+            CloseHandle(file);
+            if (m_size != 0 && m_data == nullptr) {
+                throw JsonException("Failed to map file: " + path);
+            }
+#else
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                throw JsonException("Failed to open file: " + path + ": " + std::strerror(errno));
+            }
+            struct stat status {};
+            if (::fstat(fd, &status) != 0) {
+                ::close(fd);
+                throw JsonException("Failed to get file size: " + path);
+            }
+            m_size = static_cast<size_t>(status.st_size);
+            // 空文件不能映射
+            if (m_size != 0) {
+                void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) {
+                    ::close(fd);
+                    throw JsonException("Failed to map file: " + path + ": " +
+                                        std::strerror(errno));
+                }
+                m_data = static_cast<const char*>(data);
+            }
+            ::close(fd);
+#endif
+        }
+
+        ~FileMapping() {
+            if (m_data == nullptr) {
+                return;
+            }
+#if defined(_WIN32)
+            UnmapViewOfFile(m_data);
+#else
+            ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+        }
+
+        FileMapping(const FileMapping&)            = delete;
+        FileMapping& operator=(const FileMapping&) = delete;
+
+        /**
+         * @brief 获取文件内容。
+         */
+        std::string_view view() const noexcept {
+            return m_data == nullptr ? std::string_view() : std::string_view(m_data, m_size);
+        }
+
+      private:
+        const char* m_data = nullptr;  ///< 映射的起始地址，空文件为 nullptr
+        size_t      m_size = 0;        ///< 文件大小
+    };
+
+    /**
+     * @brief 把整个文件读入字符串。
+     *
+     * 先按文件大小一次性读取，再读入剩余的内容（文件大小未知或读取时文件变长）
+     * @param path 文件路径。
+     * @return 文件内容。
+     * @exception JsonException 如果无法打开或读取文件，抛出异常。
+     */
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            throw JsonException("Failed to open file: " + path);
+        }
+        std::string content;
+        file.seekg(0, std::ios::end);
+        const std::streamoff size = file.tellg();
+        file.clear();
+        file.seekg(0, std::ios::beg);
+        if (size > 0) {
+            content.resize(static_cast<size_t>(size));
+            file.read(content.data(), size);
+            content.resize(static_cast<size_t>(file.gcount()));
+        }
+        char buffer[1 << 16];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+            content.append(buffer, static_cast<size_t>(file.gcount()));
+        }
+        if (file.bad()) {
+            throw JsonException("Failed to read file: " + path);
+        }
+        return content;
+    }
+
+    JsonValue parseFile(const std::string& path, const ParserOptions& options) {
+        return parse(readFile(path), options);
+    }
+
+    Document parseDocumentFile(const std::string& path, const ParserOptions& options) {
+        auto mapping = std::make_shared<const FileMapping>(path);
+        return parseDocument(mapping->view(), mapping, options);
+    }
+}  // namespace ccjson::parser
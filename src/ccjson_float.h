@@ -0,0 +1,37 @@
+#ifndef CCJSON_FLOAT_H
+#define CCJSON_FLOAT_H
+
+#include <cstdint>
+
+/**
+ * @file ccjson_float.h
+ * @brief 解析器内部使用的十进制到 double 的转换（不对外公开）。
+ *
+ * 采用 Eisel–Lemire 算法：用 128 位截断的 5 的幂与十进制尾数相乘，
+ * 绝大多数输入只需一到两次 64 位乘法即可得到正确舍入的结果；
+ * 有效数字超过 19 位且无法确定舍入方向时退回 std::from_chars。
+ */
+
+namespace ccjson::fp {
+    /**
+     * @struct Decimal
+     * @brief 已经拆分好的十进制数：value = (-1)^negative * mantissa * 10^exponent。
+     */
+    struct Decimal {
+        uint64_t mantissa;   ///< 十进制尾数（最多 19 位有效数字）
+        int64_t  exponent;   ///< 十进制指数
+        bool     negative;   ///< 是否为负数
+        bool     truncated;  ///< 有效数字超过 19 位，mantissa 只保留了前 19 位
+    };
+
+    /**
+     * @brief 将十进制数转换为最接近的 double（就近舍入，平局取偶）。
+     * @param decimal 拆分好的十进制数。
+     * @param first 原始数字文本的起始位置，仅在慢速路径中使用
+     * @param last 原始数字文本的结束位置
+     * @return 转换结果；上溢时返回 ±inf，下溢时返回 ±0
+     */
+    double toDouble(const Decimal& decimal, const char* first, const char* last) noexcept;
+}  // namespace ccjson::fp
+
+#endif
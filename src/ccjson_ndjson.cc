@@ -0,0 +1,321 @@
+#include "ccjson.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <istream>
+#include <mutex>
+#include <thread>
+
+namespace ccjson::parser {
+    /**
+     * @brief 一批连续的 NDJSON 记录，是工作线程处理的最小单位。
+     */
+    struct NdjsonBatch {
+        std::shared_ptr<const std::string>        buffer;            ///< 流式读取时持有本批的输入块
+        std::string_view                          text;              ///< 本批的输入，以完整的行结束
+        size_t                                    offset   = 0;      ///< text 在整个输入中的起始位置
+        size_t                                    line     = 0;      ///< text 第一行的行号
+        size_t                                    sequence = 0;      ///< 批的提交序号
+        std::vector<std::pair<size_t, JsonValue>> records;           ///< 按顺序回调时暂存的解析结果
+        std::exception_ptr                        error;             ///< 解析或回调抛出的异常
+        bool                                      done     = false;  ///< 是否已经处理完成
+    };
+
+    /**
+     * @brief NDJSON 并行解析引擎：调用线程切分输入并提交任务，工作线程池解析。
+     *
+     * 同时在处理中的批数有上限，调用线程在提交受阻时交付已经完成的批，
+     * 因此内存占用与输入大小无关。
+     */
+    class NdjsonEngine {
+      public:
+        NdjsonEngine(const NdjsonCallback& callback, const NdjsonOptions& options)
+            : m_callback(callback), m_options(options) {
+            size_t threads = m_options.threads;
+            if (threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            if (m_options.batchSize == 0) {
+                m_options.batchSize = NdjsonOptions().batchSize;
+            }
+            m_window = threads * 4;
+            startWorkers(threads);
+        }
+
+        ~NdjsonEngine() {
+            stopWorkers();
+        }
+
+        NdjsonEngine(const NdjsonEngine&)            = delete;
+        NdjsonEngine& operator=(const NdjsonEngine&) = delete;
+
+        /**
+         * @brief 将一段以完整的行结束（或位于输入末尾）的输入切分为批并提交。
+         * @param buffer 持有输入的对象（可以为空）
+         * @param text 输入。
+         * @param offset text 在整个输入中的起始位置。
+         */
+        void submit(const std::shared_ptr<const std::string>& buffer,
+                    std::string_view                          text,
+                    size_t                                    offset) {
+            size_t begin = 0;
+            while (begin < text.size()) {
+                size_t end = std::min(begin + m_options.batchSize, text.size());
+                if (end < text.size()) {
+                    const char* newline = static_cast<const char*>(
+                        std::memchr(text.data() + end, '\n', text.size() - end));
+                    end = newline == nullptr ? text.size()
+                                             : static_cast<size_t>(newline - text.data()) + 1;
+                }
+                auto batch      = std::make_shared<NdjsonBatch>();
+                batch->buffer   = buffer;
+                batch->text     = text.substr(begin, end - begin);
+                batch->offset   = offset + begin;
+                batch->line     = m_line;
+                batch->sequence = m_sequence++;
+                m_line += static_cast<size_t>(
+                    std::count(batch->text.begin(), batch->text.end(), '\n'));
+                while (inflight() >= m_window) {
+                    deliver();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_queue.push_back(batch);
+                    m_inflight.push_back(std::move(batch));
+                }
+                m_ready.notify_one();
+                begin = end;
+            }
+        }
+
+        /**
+         * @brief 等待所有批处理完成并交付。
+         * @return 解析的记录数。
+         */
+        size_t finish() {
+            while (inflight() != 0) {
+                deliver();
+            }
+            return m_records.load();
+        }
+
+      private:
+        /**
+         * @brief 启动工作线程。
+         *
+         * 构造函数抛出异常时析构函数不会执行，因此创建线程失败时先停止并等待已经启动的线程，
+         * 再重新抛出异常，避免销毁仍可 join 的 std::thread 导致 std::terminate。
+         * @param threads 工作线程数。
+         * @exception std::system_error 如果无法创建线程，重新抛出异常。
+         */
+        void startWorkers(size_t threads) {
+            m_workers.reserve(threads);
+            try {
+                for (size_t i = 0; i < threads; ++i) {
+                    m_workers.emplace_back([this] { work(); });
+                }
+            } catch (...) {
+                stopWorkers();
+                throw;
+            }
+        }
+
+        /**
+         * @brief 通知所有工作线程退出并等待它们结束。
+         */
+        void stopWorkers() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_ready.notify_all();
+            for (auto& worker : m_workers) {
+                worker.join();
+            }
+        }
+
+        size_t inflight() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_inflight.size();
+        }
+
+        /**
+         * @brief 等待至少一批完成，并交付所有可以交付的批。
+         *
+         * 按顺序回调时只交付最前面连续完成的批，回调在调用线程中执行。
+         * @exception 重新抛出批中记录的异常。
+         */
+        void deliver() {
+            std::vector<std::shared_ptr<NdjsonBatch>> ready;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_options.ordered) {
+                    m_done.wait(lock, [&] { return m_inflight.front()->done; });
+                    while (!m_inflight.empty() && m_inflight.front()->done) {
+                        ready.push_back(std::move(m_inflight.front()));
+                        m_inflight.pop_front();
+                    }
+                } else {
+                    auto isDone = [](const auto& batch) { return batch->done; };
+                    m_done.wait(lock, [&] {
+                        return std::any_of(m_inflight.begin(), m_inflight.end(), isDone);
+                    });
+                    auto pending = std::stable_partition(
+                        m_inflight.begin(), m_inflight.end(), isDone);
+                    std::move(m_inflight.begin(), pending, std::back_inserter(ready));
+                    m_inflight.erase(m_inflight.begin(), pending);
+                }
+            }
+            for (auto& batch : ready) {
+                for (auto& [line, value] : batch->records) {
+                    m_callback(line, std::move(value));
+                }
+                if (batch->error) {
+                    std::rethrow_exception(batch->error);
+                }
+            }
+        }
+
+        /**
+         * @brief 工作线程：依次取出批并解析，出错后跳过剩余的批。
+         *
+         * 按顺序回调时出错批之前的批仍然要解析，只跳过序号更大的批，
+         * 保证出错行之前的记录都已经回调。
+         */
+        void work() {
+            while (true) {
+                std::shared_ptr<NdjsonBatch> batch;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_ready.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                    if (m_stop) {
+                        return;
+                    }
+                    batch = std::move(m_queue.front());
+                    m_queue.pop_front();
+                }
+                const size_t failed = m_failed.load(std::memory_order_relaxed);
+                if (m_options.ordered ? batch->sequence < failed : failed == NO_FAILURE) {
+                    parseBatch(*batch);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    batch->done = true;
+                }
+                m_done.notify_all();
+            }
+        }
+
+        /**
+         * @brief 解析一批记录，异常记录在批中由调用线程重新抛出。
+         * @param batch 要解析的批。
+         */
+        void parseBatch(NdjsonBatch& batch) {
+            const std::string_view text  = batch.text;
+            size_t                 line  = batch.line;
+            size_t                 begin = 0;
+            try {
+                while (begin < text.size()) {
+                    size_t end = text.find('\n', begin);
+                    if (end == std::string_view::npos) {
+                        end = text.size();
+                    }
+                    std::string_view record = text.substr(begin, end - begin);
+                    // 跳过空行（包括 \r\n 换行留下的 \r）
+                    if (record.find_first_not_of(" \t\r") != std::string_view::npos) {
+                        JsonValue value;
+                        try {
+                            value = parse(record, m_options.parser);
+                        } catch (const JsonParseException& e) {
+                            throw JsonParseException(e.message(),
+                                                     batch.offset + begin + e.position());
+                        }
+                        m_records.fetch_add(1, std::memory_order_relaxed);
+                        if (m_options.ordered) {
+                            batch.records.emplace_back(line, std::move(value));
+                        } else {
+                            m_callback(line, std::move(value));
+                        }
+                    }
+                    line++;
+                    begin = end + 1;
+                }
+            } catch (...) {
+                batch.error = std::current_exception();
+                // 记录出错批中最小的序号
+                size_t failed = m_failed.load(std::memory_order_relaxed);
+                while (batch.sequence < failed &&
+                       !m_failed.compare_exchange_weak(failed, batch.sequence,
+                                                       std::memory_order_relaxed)) {
+                }
+            }
+        }
+
+        const NdjsonCallback& m_callback;    ///< 记录的回调
+        NdjsonOptions         m_options;     ///< 解析配置
+        size_t                m_window   = 0;  ///< 同时处理中的批数上限
+        size_t                m_line     = 0;  ///< 下一批第一行的行号
+        size_t                m_sequence = 0;  ///< 下一批的提交序号
+
+        std::mutex                               m_mutex;         ///< 保护以下队列和标记
+        std::condition_variable                  m_ready;         ///< 有新的批或需要退出
+        std::condition_variable                  m_done;          ///< 有批处理完成
+        std::deque<std::shared_ptr<NdjsonBatch>> m_queue;         ///< 等待解析的批
+        std::deque<std::shared_ptr<NdjsonBatch>> m_inflight;      ///< 已提交、尚未交付的批
+        bool                                     m_stop = false;  ///< 工作线程是否应当退出
+
+        static constexpr size_t NO_FAILURE = static_cast<size_t>(-1);  ///< 没有批出错
+
+        std::atomic<size_t>      m_failed{NO_FAILURE};  ///< 出错的批中最小的序号
+        std::atomic<size_t>      m_records{0};          ///< 已解析的记录数
+        std::vector<std::thread> m_workers;             ///< 工作线程
+    };
+
+    size_t parseNdjson(std::string_view      input,
+                       const NdjsonCallback& callback,
+                       const NdjsonOptions&  options) {
+        NdjsonEngine engine(callback, options);
+        engine.submit(nullptr, input, 0);
+        return engine.finish();
+    }
+
+    size_t parseNdjson(std::istream&         input,
+                       const NdjsonCallback& callback,
+                       const NdjsonOptions&  options) {
+        NdjsonEngine engine(callback, options);
+        // 每次读取若干批的输入，最后一个不完整的行留到下一块；
+        // 读取量不小于留下的部分，超长的行只会被复制常数次
+        const size_t blockSize = std::max<size_t>(options.batchSize * 4, 1 << 16);
+        std::string  carry;
+        size_t       offset = 0;
+        while (true) {
+            auto         block = std::make_shared<std::string>(std::move(carry));
+            const size_t kept  = block->size();
+            const size_t size  = std::max(blockSize, kept);
+            block->resize(kept + size);
+            input.read(block->data() + kept, static_cast<std::streamsize>(size));
+            block->resize(kept + static_cast<size_t>(input.gcount()));
+            if (input.bad()) {
+                throw JsonException("Failed to read NDJSON input");
+            }
+            const bool eof = !input;
+            size_t     cut = block->size();
+            if (!eof) {
+                size_t newline = block->rfind('\n');
+                cut            = newline == std::string::npos ? 0 : newline + 1;
+            }
+            carry.assign(block->data() + cut, block->size() - cut);
+            if (cut != 0) {
+                std::string_view text(block->data(), cut);
+                engine.submit(std::move(block), text, offset);
+                offset += cut;
+            }
+            if (eof) {
+                break;
+            }
+        }
+        return engine.finish();
+    }
+}  // namespace ccjson::parser
@@ -0,0 +1,38 @@
+#include "ccjson.h"
+
+#include <cstring>
+
+namespace ccjson {
+std::string_view StringPool::intern(std::string_view value) {
+    m_stats.lookups++;
+    if (auto it = m_strings.find(value); it != m_strings.end()) {
+        m_stats.hits++;
+        m_stats.savedBytes += value.size();
+        return *it;
+    }
+    char* data;
+    if (value.size() > BLOCK_SIZE / 4) {
+        // 较长的字符串单独分配，不浪费当前块的剩余空间
+        data = m_large.emplace_back(std::make_unique<char[]>(value.size())).get();
+    } else {
+        if (m_blocks.empty() || value.size() > m_free) {
+            m_blocks.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+            m_free = BLOCK_SIZE;
+        }
+        data = m_blocks.back().get() + (BLOCK_SIZE - m_free);
+        m_free -= value.size();
+    }
+    std::memcpy(data, value.data(), value.size());
+    m_stats.strings++;
+    m_stats.bytes += value.size();
+    return *m_strings.emplace(data, value.size()).first;
+}
+
+void StringPool::clear() noexcept {
+    m_strings.clear();
+    m_blocks.clear();
+    m_large.clear();
+    m_free  = 0;
+    m_stats = {};
+}
+}  // namespace ccjson
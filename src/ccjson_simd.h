@@ -0,0 +1,569 @@
+#ifndef CCJSON_SIMD_H
+#define CCJSON_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file ccjson_simd.h
+ * @brief 解析器内部使用的向量化扫描函数（不对外公开）。
+ *
+ * 根据编译目标自动选择实现：
+ * - 定义了 __AVX2__ 时使用 32 字节的 AVX2 指令；
+ * - x86-64（SSE2 为基线指令集）使用 16 字节的 SSE2 指令；
+ * - 其他平台使用 8 字节一组的 SWAR（SIMD Within A Register）实现。
+ *
+ * 所有函数都不会读取 [data, data + size) 之外的内存。
+ */
+
+#if defined(__AVX2__)
+#    define CCJSON_SIMD_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define CCJSON_SIMD_SSE2 1
+#endif
+
+#if defined(CCJSON_SIMD_AVX2)
+#    include <immintrin.h>
+#elif defined(CCJSON_SIMD_SSE2)
+#    include <emmintrin.h>
+#endif
+#if defined(__PCLMUL__)
+#    include <wmmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+namespace ccjson::simd {
+
+/**
+ * @brief 判断字符是否为 JSON 规范中的空白字符。
+ * @param c 待判断的字符。
+ * @return 如果是空格、\\t、\\n 或 \\r，返回 true。
+ * @note 不可使用 std::isspace，json 规范中定义的 ws 只可为空格、\\t、\\n、\\r
+ */
+inline bool isWhitespace(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @brief 计算 64 位整数末尾 0 的个数。
+ * @param x 输入值，不能为 0。
+ * @return 末尾 0 的个数。
+ */
+inline int trailingZeros(uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+/**
+ * @brief 计算 64 位整数开头 0 的个数。
+ * @param x 输入值，不能为 0。
+ * @return 开头 0 的个数。
+ */
+inline int leadingZeros(uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, x);
+    return 63 - static_cast<int>(index);
+#else
+    return __builtin_clzll(x);
+#endif
+}
+
+/**
+ * @brief 计算 64 位整数中 1 的个数。
+ * @param x 输入值。
+ * @return 1 的个数。
+ */
+inline int popCount(uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return static_cast<int>(__popcnt64(x));
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+/**
+ * @brief 以小端字节序从任意地址读取 8 个字节。
+ * @param p 读取位置。
+ * @return 读取到的 64 位整数，p[0] 位于最低字节。
+ */
+inline uint64_t loadLittleEndian64(const char* p) noexcept {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+/**
+ * @brief SWAR：将 x 中值为 0 的字节标记为 0x80，其余字节为 0x00。
+ *
+ * 与常见的 (x - 0x01..) & ~x & 0x80.. 不同，该写法不会在 0 字节之后产生误报，
+ * 因此可以用来精确定位第一个命中的字节。
+ * @param x 8 个字节打包成的 64 位整数。
+ * @return 每个字节的命中标记。
+ */
+inline uint64_t zeroBytes(uint64_t x) noexcept {
+    constexpr uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+    return ~(((x & low7) + low7) | x | low7);
+}
+
+/**
+ * @brief SWAR：将 x 中等于 c 的字节标记为 0x80，其余字节为 0x00。
+ * @param x 8 个字节打包成的 64 位整数。
+ * @param c 要查找的字符。
+ * @return 每个字节的命中标记。
+ */
+inline uint64_t equalBytes(uint64_t x, char c) noexcept {
+    return zeroBytes(x ^ (0x0101010101010101ULL * static_cast<uint8_t>(c)));
+}
+
+/**
+ * @brief SWAR：将 x 中小于 n 的字节标记为 0x80，其余字节为 0x00。
+ * @param x 8 个字节打包成的 64 位整数。
+ * @param n 比较上限，必须不大于 128。
+ * @return 每个字节的命中标记。
+ */
+inline uint64_t lessBytes(uint64_t x, uint8_t n) noexcept {
+    constexpr uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+    constexpr uint64_t high = 0x8080808080808080ULL;
+    return ~(((x & low7) + 0x0101010101010101ULL * static_cast<uint8_t>(0x80 - n)) | x) & high;
+}
+
+#if defined(CCJSON_SIMD_AVX2)
+/**
+ * @brief 计算 32 个字节中空白字符的位图。
+ * @param p 读取位置，p[0, 32) 必须可读。
+ * @return 第 i 位为 1 表示 p[i] 是空白字符。
+ */
+inline uint32_t whitespaceMask32(const char* p) noexcept {
+    const __m256i v  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i ws = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+}
+#endif
+
+#if defined(CCJSON_SIMD_SSE2)
+/**
+ * @brief 计算 16 个字节中空白字符的位图。
+ * @param p 读取位置，p[0, 16) 必须可读。
+ * @return 低 16 位中第 i 位为 1 表示 p[i] 是空白字符。
+ */
+inline uint32_t whitespaceMask16(const char* p) noexcept {
+    const __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                                 _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                                 _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+    return static_cast<uint32_t>(_mm_movemask_epi8(ws));
+}
+#endif
+
+/**
+ * @brief 跳过从 position 开始的连续空白字符。
+ *
+ * 紧凑格式的 JSON 中大多数位置根本没有空白，或只有一个空格（如 ": "），
+ * 所以先逐字节判断前两个字符；只有遇到更长的空白（缩进）时才进入按块扫描的循环，
+ * 每次比较 32/16/8 个字节。
+ * @param data 输入数据。
+ * @param size 输入数据长度。
+ * @param position 起始位置。
+ * @return 第一个非空白字符的位置，若直到末尾都是空白则返回 size。
+ */
+inline size_t skipWhitespace(const char* data, size_t size, size_t position) noexcept {
+    if (position >= size || !isWhitespace(data[position])) {
+        return position;
+    }
+    if (++position >= size || !isWhitespace(data[position])) {
+        return position;
+    }
+#if defined(CCJSON_SIMD_AVX2)
+    while (position + 32 <= size) {
+        const uint32_t other = ~whitespaceMask32(data + position);
+        if (other != 0) {
+            return position + trailingZeros(other);
+        }
+        position += 32;
+    }
+#endif
+#if defined(CCJSON_SIMD_SSE2)
+    while (position + 16 <= size) {
+        const uint32_t other = ~whitespaceMask16(data + position) & 0xFFFFu;
+        if (other != 0) {
+            return position + trailingZeros(other);
+        }
+        position += 16;
+    }
+#else
+    while (position + 8 <= size) {
+        const uint64_t x  = loadLittleEndian64(data + position);
+        const uint64_t ws = equalBytes(x, ' ') | equalBytes(x, '\t') | equalBytes(x, '\n') |
+                            equalBytes(x, '\r');
+        const uint64_t other = ~ws & 0x8080808080808080ULL;
+        if (other != 0) {
+            return position + (trailingZeros(other) >> 3);
+        }
+        position += 8;
+    }
+#endif
+    while (position < size && isWhitespace(data[position])) {
+        ++position;
+    }
+    return position;
+}
+
+#if defined(CCJSON_SIMD_AVX2)
+/**
+ * @brief 计算 32 个字节中字符串特殊字符（引号、反斜杠、控制字符）的位图。
+ * @param p 读取位置，p[0, 32) 必须可读。
+ * @return 第 i 位为 1 表示 p[i] 是 '"'、'\\' 或小于 0x20 的字节。
+ */
+inline uint32_t stringSpecialMask32(const char* p) noexcept {
+    const __m256i v       = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(v, _mm256_set1_epi8(0x1F)), v);
+    const __m256i special = _mm256_or_si256(
+        control, _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                                 _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(special));
+}
+#endif
+
+#if defined(CCJSON_SIMD_SSE2)
+/**
+ * @brief 计算 16 个字节中字符串特殊字符（引号、反斜杠、控制字符）的位图。
+ * @param p 读取位置，p[0, 16) 必须可读。
+ * @return 低 16 位中第 i 位为 1 表示 p[i] 是 '"'、'\\' 或小于 0x20 的字节。
+ */
+inline uint32_t stringSpecialMask16(const char* p) noexcept {
+    const __m128i v       = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1F)), v);
+    const __m128i special =
+        _mm_or_si128(control, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                           _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))));
+    return static_cast<uint32_t>(_mm_movemask_epi8(special));
+}
+#endif
+
+/**
+ * @brief 判断字节在 JSON 字符串中是否需要特殊处理。
+ * @param c 待判断的字符。
+ * @return 如果是 '"'、'\\' 或控制字符（小于 0x20），返回 true。
+ */
+inline bool isStringSpecial(char c) noexcept {
+    return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+/**
+ * @brief 查找字符串内容中下一个需要特殊处理的字节。
+ *
+ * 字符串中绝大部分字节都可以原样拷贝，只有结束引号、转义符和非法的控制字符需要处理，
+ * 因此按块比较，一次跳过 32/16/8 个普通字节。
+ * @param data 输入数据。
+ * @param size 输入数据长度。
+ * @param position 起始位置（位于字符串内容中）
+ * @return 第一个 '"'、'\\' 或控制字符的位置，若不存在则返回 size。
+ */
+inline size_t findStringSpecial(const char* data, size_t size, size_t position) noexcept {
+#if defined(CCJSON_SIMD_AVX2)
+    while (position + 32 <= size) {
+        const uint32_t special = stringSpecialMask32(data + position);
+        if (special != 0) {
+            return position + trailingZeros(special);
+        }
+        position += 32;
+    }
+#endif
+#if defined(CCJSON_SIMD_SSE2)
+    while (position + 16 <= size) {
+        const uint32_t special = stringSpecialMask16(data + position);
+        if (special != 0) {
+            return position + trailingZeros(special);
+        }
+        position += 16;
+    }
+#else
+    while (position + 8 <= size) {
+        const uint64_t x = loadLittleEndian64(data + position);
+        const uint64_t special =
+            equalBytes(x, '"') | equalBytes(x, '\\') | lessBytes(x, 0x20);
+        if (special != 0) {
+            return position + (trailingZeros(special) >> 3);
+        }
+        position += 8;
+    }
+#endif
+    while (position < size && !isStringSpecial(data[position])) {
+        ++position;
+    }
+    return position;
+}
+
+/**
+ * @brief 查找下一个非 ASCII 字节（最高位为 1 的字节）
+ * @param data 输入数据。
+ * @param size 输入数据长度。
+ * @param position 起始位置。
+ * @return 第一个非 ASCII 字节的位置，若不存在则返回 size。
+ */
+inline size_t findNonAscii(const char* data, size_t size, size_t position) noexcept {
+#if defined(CCJSON_SIMD_AVX2)
+    while (position + 32 <= size) {
+        const __m256i  v    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+        const uint32_t high = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+        if (high != 0) {
+            return position + trailingZeros(high);
+        }
+        position += 32;
+    }
+#endif
+#if defined(CCJSON_SIMD_SSE2)
+    while (position + 16 <= size) {
+        const __m128i  v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+        const uint32_t high = static_cast<uint32_t>(_mm_movemask_epi8(v));
+        if (high != 0) {
+            return position + trailingZeros(high);
+        }
+        position += 16;
+    }
+#else
+    while (position + 8 <= size) {
+        const uint64_t high = loadLittleEndian64(data + position) & 0x8080808080808080ULL;
+        if (high != 0) {
+            return position + (trailingZeros(high) >> 3);
+        }
+        position += 8;
+    }
+#endif
+    while (position < size && static_cast<unsigned char>(data[position]) < 0x80) {
+        ++position;
+    }
+    return position;
+}
+
+/**
+ * @brief 校验输入是否为有效的 UTF-8。
+ *
+ * JSON 文本绝大部分是 ASCII，按块跳过 ASCII 字节，只在遇到非 ASCII 字节时逐个检查
+ * 多字节序列，直到重新回到 ASCII。拒绝过长编码、代理区码点（U+D800 ~ U+DFFF）以及
+ * 大于 U+10FFFF 的码点。
+ * @param data 输入数据。
+ * @param size 输入数据长度。
+ * @return 第一个无效序列的起始位置，输入有效时返回 size。
+ */
+inline size_t validateUtf8(const char* data, size_t size) noexcept {
+    const auto* bytes    = reinterpret_cast<const unsigned char*>(data);
+    size_t      position = 0;
+    while ((position = findNonAscii(data, size, position)) < size) {
+        do {
+            const unsigned char lead = bytes[position];
+            // 第二个字节的取值范围，用于排除过长编码、代理区和超出范围的码点
+            unsigned char low    = 0x80;
+            unsigned char high   = 0xBF;
+            size_t        length = 0;
+            if (lead >= 0xC2 && lead <= 0xDF) {
+                length = 2;
+            } else if (lead >= 0xE0 && lead <= 0xEF) {
+                length = 3;
+                low    = lead == 0xE0 ? 0xA0 : 0x80;
+                high   = lead == 0xED ? 0x9F : 0xBF;
+            } else if (lead >= 0xF0 && lead <= 0xF4) {
+                length = 4;
+                low    = lead == 0xF0 ? 0x90 : 0x80;
+                high   = lead == 0xF4 ? 0x8F : 0xBF;
+            } else {
+                return position;
+            }
+            if (length > size - position || bytes[position + 1] < low ||
+                bytes[position + 1] > high) {
+                return position;
+            }
+            for (size_t i = 2; i < length; ++i) {
+                if ((bytes[position + i] & 0xC0) != 0x80) {
+                    return position;
+                }
+            }
+            position += length;
+        } while (position < size && bytes[position] >= 0x80);
+    }
+    return size;
+}
+
+/**
+ * @brief SWAR：判断 8 个字节是否全部为十进制数字。
+ * @param x 以小端字节序读取的 8 个字节。
+ * @return 全部为 '0' ~ '9' 时返回 true。
+ */
+inline bool isEightDigits(uint64_t x) noexcept {
+    // 数字的高半字节都是 3；低半字节加 6 后不能进位到高半字节
+    return ((x & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+           0x3333333333333333ULL;
+}
+
+/**
+ * @brief SWAR：将 8 个十进制数字字符转换为整数。
+ *
+ * 先把相邻的 1 位数合并为 2 位数，再用两次乘法把 4 个 2 位数合并为 8 位数，
+ * 共 3 次乘法，代替逐字节的 8 次乘加。
+ * @param x 以小端字节序读取的 8 个数字字符（需先用 isEightDigits 检查）
+ * @return 对应的整数值（0 ~ 99999999）
+ */
+inline uint32_t parseEightDigits(uint64_t x) noexcept {
+    constexpr uint64_t mask = 0x000000FF000000FFULL;
+    constexpr uint64_t mul1 = 100 + (1000000ULL << 32);
+    constexpr uint64_t mul2 = 1 + (10000ULL << 32);
+    x -= 0x3030303030303030ULL;
+    x = (x * 10) + (x >> 8);
+    x = (((x & mask) * mul1) + (((x >> 16) & mask) * mul2)) >> 32;
+    return static_cast<uint32_t>(x);
+}
+
+/**
+ * @struct BracketMasks
+ * @brief 跳过数组和对象时使用的 64 字节输入块位图，第 i 位对应块内第 i 个字节。
+ */
+struct BracketMasks {
+    uint64_t quote;      ///< '"'
+    uint64_t backslash;  ///< '\\'
+    uint64_t open;       ///< '[' 与 '{'
+    uint64_t close;      ///< ']' 与 '}'
+};
+
+/**
+ * @brief 对 64 个字节计算引号、反斜杠与括号的位图。
+ *
+ * '{' 与 '['、'}' 与 ']' 只差 0x20 这一位，所以先或上 0x20 再比较，
+ * 四种括号只需要两次比较；逗号、冒号和空白不需要区分。
+ * @param p 读取位置，p[0, 64) 必须可读。
+ * @return 各类字符的位图。
+ */
+inline BracketMasks classifyBrackets(const char* p) noexcept {
+    BracketMasks masks{};
+#if defined(CCJSON_SIMD_AVX2)
+    for (int i = 0; i < 2; ++i) {
+        const __m256i v      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * i));
+        const __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+        const uint32_t quote =
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+        const uint32_t backslash =
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')));
+        const uint32_t open =
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')));
+        const uint32_t close =
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+        const int shift = 32 * i;
+        masks.quote |= static_cast<uint64_t>(quote) << shift;
+        masks.backslash |= static_cast<uint64_t>(backslash) << shift;
+        masks.open |= static_cast<uint64_t>(open) << shift;
+        masks.close |= static_cast<uint64_t>(close) << shift;
+    }
+#elif defined(CCJSON_SIMD_SSE2)
+    for (int i = 0; i < 4; ++i) {
+        const __m128i v      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * i));
+        const __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        const int     shift  = 16 * i;
+        masks.quote |=
+            static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))))
+            << shift;
+        masks.backslash |=
+            static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))))
+            << shift;
+        masks.open |=
+            static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{'))))
+            << shift;
+        masks.close |=
+            static_cast<uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))))
+            << shift;
+    }
+#else
+    for (int i = 0; i < 8; ++i) {
+        const uint64_t x      = loadLittleEndian64(p + 8 * i);
+        const uint64_t folded = x | 0x2020202020202020ULL;
+        // 把每个字节的 0x80 标记压缩成 8 个连续的位
+        constexpr uint64_t gather = 0x0102040810204080ULL;
+        const int          shift  = 8 * i;
+        masks.quote |= (((equalBytes(x, '"') >> 7) * gather) >> 56) << shift;
+        masks.backslash |= (((equalBytes(x, '\\') >> 7) * gather) >> 56) << shift;
+        masks.open |= (((equalBytes(folded, '{') >> 7) * gather) >> 56) << shift;
+        masks.close |= (((equalBytes(folded, '}') >> 7) * gather) >> 56) << shift;
+    }
+#endif
+    return masks;
+}
+
+/**
+ * @brief 计算前缀异或：结果的第 i 位等于 x 第 0 ~ i 位的异或。
+ *
+ * 对引号位图求前缀异或即可得到“位于字符串内”的位图。
+ * @param x 输入位图。
+ * @return 前缀异或结果。
+ */
+inline uint64_t prefixXor(uint64_t x) noexcept {
+#if defined(__PCLMUL__)
+    const __m128i product =
+        _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(x)), _mm_set1_epi8(-1), 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+#else
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+#endif
+}
+
+/**
+ * @class EscapeScanner
+ * @brief 跨块计算被反斜杠转义的字符。
+ *
+ * 连续的反斜杠两两配对，只有奇数长度的反斜杠序列才会转义其后的字符。
+ * 利用减法的借位一次性区分从奇数位、偶数位开始的反斜杠序列，无需逐字节判断。
+ */
+class EscapeScanner {
+  public:
+    /**
+     * @brief 处理下一个 64 字节块。
+     * @param backslash 当前块的反斜杠位图。
+     * @return 当前块中被转义的字符位图（包括被转义的反斜杠）
+     */
+    uint64_t next(uint64_t backslash) noexcept {
+        if (backslash == 0) {
+            const uint64_t escaped = m_nextIsEscaped;
+            m_nextIsEscaped        = 0;
+            return escaped;
+        }
+        constexpr uint64_t oddBits = 0xAAAAAAAAAAAAAAAAULL;
+        // 被转义的反斜杠不能再转义后面的字符
+        const uint64_t potentialEscape = backslash & ~m_nextIsEscaped;
+        // 奇数位开始的序列在减法后变为 0，偶数位开始的序列保持为 1，再与奇数位异或即可
+        // 得到“转义符 + 被转义字符”的交替位图
+        const uint64_t code    = (((potentialEscape << 1) | oddBits) - potentialEscape) ^ oddBits;
+        const uint64_t escaped = code ^ (backslash | m_nextIsEscaped);
+        m_nextIsEscaped        = (code & backslash) >> 63;
+        return escaped;
+    }
+
+  private:
+    uint64_t m_nextIsEscaped = 0;  ///< 上一块最后一个字节是否为转义符
+};
+
+}  // namespace ccjson::simd
+
+#endif
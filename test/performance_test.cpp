@@ -1,11 +1,20 @@
 #include "json.hpp"
 #include <ccjson.h>
+#include <atomic>
+#include <charconv>
 #include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <new>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -18,6 +27,65 @@
 using json = nlohmann::json;
 using namespace ccjson;
 
+// 替换的 operator delete 内联到调用处后，GCC 会把其中的 free 与 operator new 配对，
+// 误报 -Wmismatched-new-delete，因此禁止内联
+#if defined(_MSC_VER)
+#    define TEST_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#    define TEST_NOINLINE __attribute__((noinline))
+#else
+#    define TEST_NOINLINE
+#endif
+
+// 统计全局内存分配次数（用于验证解析时每个节点只分配一次）和申请的总字节数
+static std::atomic<size_t> g_allocation_count{0};
+static std::atomic<size_t> g_allocation_bytes{0};
+
+void* operator new(std::size_t size) {
+    ++g_allocation_count;
+    g_allocation_bytes += size;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+TEST_NOINLINE void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+TEST_NOINLINE void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// std::pmr::new_delete_resource() 使用带对齐参数的 operator new，同样需要统计
+void* operator new(std::size_t size, std::align_val_t align) {
+    ++g_allocation_count;
+    g_allocation_bytes += size;
+    const auto alignment = static_cast<std::size_t>(align);
+    const auto rounded   = (size + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+    if (void* ptr = _aligned_malloc(rounded == 0 ? alignment : rounded, alignment)) {
+#else
+    if (void* ptr = std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded)) {
+#endif
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+TEST_NOINLINE void operator delete(void* ptr, std::align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+TEST_NOINLINE void operator delete(void* ptr, std::size_t, std::align_val_t align) noexcept {
+    operator delete(ptr, align);
+}
+
 // 测试数据结构
 struct TestData {
     std::string              name;
@@ -240,6 +308,1382 @@ void test_ccjson_parse_performance(const std::string& json_str, int iterations)
               << std::endl;
 }
 
+// 测试ccjson在缩进格式与压缩格式下的解析性能（主要差异在于空白字符的跳过）
+void test_ccjson_whitespace_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson pretty vs minified parse performance (" << iterations
+              << " iterations)..." << std::endl;
+
+    JsonValue   value    = parser::parse(json_str);
+    std::string minified = parser::stringify(value);
+    std::string pretty   = parser::stringify(value, 4);
+
+    for (const auto& [name, input] : {std::make_pair("minified", &minified),
+                                      std::make_pair("pretty", &pretty)}) {
+        size_t whitespace = 0;
+        for (char c : *input) {
+            whitespace += (c == ' ' || c == '\t' || c == '\n' || c == '\r') ? 1 : 0;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            JsonValue result = parser::parse(*input);
+        }
+        auto end      = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        double seconds = static_cast<double>(duration.count()) / 1e6;
+        double mb      = static_cast<double>(input->size()) * iterations / 1024.0 / 1024.0;
+        std::cout << "  " << name << ": " << input->size() << " bytes ("
+                  << 100.0 * static_cast<double>(whitespace) / static_cast<double>(input->size())
+                  << "% whitespace), " << duration.count() / 1000 << "ms, " << mb / seconds
+                  << " MB/s" << std::endl;
+    }
+}
+
+// 生成以浮点数为主的地理数据（与canada.json结构相同：一个多边形，坐标为17位有效数字的经纬度）
+std::string generate_geometry_json(size_t points) {
+    std::mt19937_64                        rng(42);
+    std::uniform_real_distribution<double> longitude(-141.0, -52.0);
+    std::uniform_real_distribution<double> latitude(41.0, 83.0);
+
+    std::string result = R"({"type":"FeatureCollection","features":[{"type":"Feature",)"
+                         R"("properties":{"name":"Canada"},"geometry":{"type":"Polygon",)"
+                         R"("coordinates":[[)";
+    char buffer[64];
+    for (size_t i = 0; i < points; ++i) {
+        int length = std::snprintf(buffer, sizeof(buffer), "%s[%.17g,%.17g]", i == 0 ? "" : ",",
+                                   longitude(rng), latitude(rng));
+        result.append(buffer, static_cast<size_t>(length));
+    }
+    result += "]]}}]}";
+    return result;
+}
+
+// 测试浮点数转换性能：ccjson::parseDouble与标准库的strtod、std::from_chars对比
+void test_float_parse_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing float conversion performance (" << iterations << " iterations)..."
+              << std::endl;
+
+    // 取出文档中所有的数字文本
+    std::vector<std::string> numbers;
+    for (size_t i = 0; i < json_str.size();) {
+        if (json_str[i] == '-' || (json_str[i] >= '0' && json_str[i] <= '9')) {
+            size_t end = json_str.find_first_of(",]", i);
+            numbers.emplace_back(json_str.substr(i, end - i));
+            i = end;
+        } else {
+            ++i;
+        }
+    }
+
+    auto bench = [&](const char* name, auto&& convert) {
+        double sum   = 0;
+        auto   start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            for (const auto& number : numbers) {
+                sum += convert(number);
+            }
+        }
+        auto   end = std::chrono::high_resolution_clock::now();
+        double ns  = static_cast<double>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) /
+                    static_cast<double>(numbers.size() * iterations);
+        std::cout << "  " << name << ": " << ns << " ns/number (checksum " << sum << ")"
+                  << std::endl;
+    };
+    bench("ccjson::parseDouble", [](const std::string& s) { return parseDouble(s); });
+    bench("std::strtod", [](const std::string& s) { return std::strtod(s.c_str(), nullptr); });
+    bench("std::from_chars", [](const std::string& s) {
+        double value = 0;
+        std::from_chars(s.data(), s.data() + s.size(), value);
+        return value;
+    });
+
+    // 转换结果必须与strtod逐位一致
+    for (const auto& number : numbers) {
+        double expected = std::strtod(number.c_str(), nullptr);
+        double actual   = parseDouble(number);
+        if (std::memcmp(&expected, &actual, sizeof(double)) != 0) {
+            throw std::runtime_error("parseDouble result mismatch: " + number);
+        }
+    }
+}
+
+// 计算一棵JsonValue树至少需要的分配次数：每个节点本身一次（保存在值内部的短字符串除外），
+// 超出小字符串优化容量的字符串与超出内部容量的键各一次，非空数组与非空对象的元素存储各一次，
+// 成员数超过索引阈值的对象的哈希索引一次
+size_t count_node_allocations(const JsonValue& value) {
+    static const size_t sso_capacity = std::string().capacity();
+    switch (value.type()) {
+        // 短字符串保存在 JsonValue 内部，不分配内存
+        case JsonType::String: {
+            size_t size = value.asStringView().size();
+            if (size <= JsonValue::INLINE_STRING_CAPACITY) {
+                return 0;
+            }
+            return 1 + (size > sso_capacity ? 1 : 0);
+        }
+        case JsonType::Array: {
+            size_t count = value.asArray().empty() ? 1 : 2;
+            for (const auto& item : value.asArray()) {
+                count += count_node_allocations(item);
+            }
+            return count;
+        }
+        // 对象本身、成员数组，成员较多时还有哈希索引
+        case JsonType::Object: {
+            const JsonObject& object = value.asObject();
+            size_t            count  = object.empty() ? 1 : 2;
+            if (object.size() > JsonObject::INDEX_THRESHOLD) {
+                count++;
+            }
+            for (const auto& [key, item] : object) {
+                count += (key.size() > JsonObjectKey::INLINE_CAPACITY ? 1 : 0) +
+                         count_node_allocations(item);
+            }
+            return count;
+        }
+        default: return 0;
+    }
+}
+
+// 通过不抛出异常的只读接口累计所有字符串的长度
+size_t sum_string_size(const JsonValue& value) {
+    if (auto text = value.try_get<std::string_view>()) {
+        return text->size();
+    }
+    size_t size = 0;
+    if (const JsonArray* array = value.get_if<JsonArray>()) {
+        for (const auto& item : *array) {
+            size += sum_string_size(item);
+        }
+    } else if (const JsonObject* object = value.get_if<JsonObject>()) {
+        for (const auto& [key, item] : *object) {
+            size += sum_string_size(item);
+        }
+    }
+    return size;
+}
+
+// 测试解析时的内存分配次数：每个节点应当恰好分配一次，不应出现复制后再释放的情况
+void test_ccjson_allocation_count(const std::string& json_str) {
+    std::cout << "Testing ccjson parse allocation count..." << std::endl;
+
+    // 第一次解析用于预热解析器内部复用的栈
+    JsonValue warmup = parser::parse(json_str);
+
+    size_t    before      = g_allocation_count.load();
+    JsonValue value       = parser::parse(json_str);
+    size_t    allocations = g_allocation_count.load() - before;
+    size_t    expected    = count_node_allocations(value);
+
+    before = g_allocation_count.load();
+    {
+        json nlohmann_value = json::parse(json_str);
+    }
+    size_t nlohmann_allocations = g_allocation_count.load() - before;
+
+    std::cout << "  ccjson allocations: " << allocations << " (one per node: " << expected << ")"
+              << std::endl;
+    std::cout << "  nlohmann/json allocations: " << nlohmann_allocations << std::endl;
+    if (allocations != expected) {
+        throw std::runtime_error("ccjson parse allocated more than once per node");
+    }
+
+    // 只读访问字符串不分配内存，值内部的短字符串保持原样
+    before                = g_allocation_count.load();
+    size_t string_size    = sum_string_size(value);
+    size_t read_allocated = g_allocation_count.load() - before;
+    if (string_size == 0 || read_allocated != 0) {
+        throw std::runtime_error("ccjson read-only string access allocated");
+    }
+}
+
+// 对每个字符串调用 const 的 asString()：引用外部内存或保存在值内部的字符串转换为堆上的
+// JsonString 后内容不变，之后的 asString()、get_if<JsonString>() 与 asStringView() 都指向它
+void check_const_string_access(const JsonValue& value) {
+    if (value.isString()) {
+        const std::string expected(value.asStringView());
+        const JsonString& string = value.asString();
+        if (string != expected || &value.asString() != &string ||
+            value.get_if<JsonString>() != &string || value.asStringView().data() != string.data()) {
+            throw std::runtime_error("const asString() returned an unstable reference");
+        }
+    } else if (value.isArray()) {
+        for (const auto& item : value.asArray()) {
+            check_const_string_access(item);
+        }
+    } else if (value.isObject()) {
+        for (const auto& [key, item] : value.asObject()) {
+            check_const_string_access(item);
+        }
+    }
+}
+
+// 测试零拷贝解析：parseDocument 中不含转义的字符串和键直接引用输入，
+// parseInSitu 还会在可写缓冲区中原地反转义，含转义的字符串也不再分配；
+// ENABLE_ARENA 时所有节点从 Document 的 arena 中分配，销毁时一次性释放（耗时包括销毁）
+void test_ccjson_document_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson zero-copy document parse (" << iterations << " iterations)..."
+              << std::endl;
+
+    // json_str 比所有 Document 活得久，因此不需要额外的所有者
+    std::string_view  input(json_str);
+    // 原地解析会改写缓冲区，每次解析前重新复制输入（计入耗时）
+    std::vector<char> buffer(json_str.size());
+    auto              parse_mode = [&](int mode) {
+        if (mode == 0) {
+            JsonValue value = parser::parse(input);
+        } else if (mode == 1) {
+            Document document = parser::parseDocument(input, nullptr);
+        } else if (mode == 2) {
+            Document document = parser::parseDocument(input, nullptr, parser::ENABLE_ARENA);
+        } else {
+            std::memcpy(buffer.data(), json_str.data(), json_str.size());
+            Document document = parser::parseInSitu(buffer.data(), buffer.size());
+        }
+    };
+    const char* names[] = {"parse", "parseDocument", "parseDocument (arena)", "parseInSitu"};
+
+    for (int mode = 0; mode < 4; ++mode) {
+        size_t before = g_allocation_count.load();
+        parse_mode(mode);
+        size_t allocations = g_allocation_count.load() - before;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            parse_mode(mode);
+        }
+        auto end      = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        double seconds = static_cast<double>(duration.count()) / 1e6;
+        double mb      = static_cast<double>(json_str.size()) * iterations / 1024.0 / 1024.0;
+        std::cout << "  " << names[mode] << ": " << allocations << " allocations, "
+                  << duration.count() / 1000 << "ms, " << mb / seconds << " MB/s" << std::endl;
+    }
+
+    // 零拷贝解析的结果必须与普通解析完全一致
+    std::string expected = parser::stringify(parser::parse(input));
+    std::memcpy(buffer.data(), json_str.data(), json_str.size());
+    if (parser::stringify(parser::parseDocument(input, nullptr).root()) != expected ||
+        parser::stringify(parser::parseDocument(input, nullptr, parser::ENABLE_ARENA).root()) !=
+            expected ||
+        parser::stringify(parser::parseInSitu(buffer.data(), buffer.size()).root()) != expected) {
+        throw std::runtime_error("zero-copy document parse result mismatch");
+    }
+
+    // const 访问返回稳定的引用，arena 中的值同样可以转换
+    const Document document = parser::parseDocument(input, nullptr);
+    const Document arena    = parser::parseDocument(input, nullptr, parser::ENABLE_ARENA);
+    check_const_string_access(document.root());
+    check_const_string_access(arena.root());
+    if (parser::stringify(document.root()) != expected ||
+        parser::stringify(arena.root()) != expected) {
+        throw std::runtime_error("const asString() changed the document");
+    }
+}
+
+// 测试字符串池：缓存多份结构相同的文档，键和短字符串值在文档之间共享存储
+void test_ccjson_intern_performance(const std::string& json_str, int documents) {
+    std::cout << "Testing ccjson interned parse (" << documents << " cached documents)..."
+              << std::endl;
+
+    // 预热解析器内部复用的栈，避免计入第一次解析时栈的分配
+    JsonValue warmup = parser::parse(json_str);
+
+    std::vector<JsonValue> values;
+    size_t                 bytes = g_allocation_bytes.load();
+    size_t                 count = g_allocation_count.load();
+    auto                   start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < documents; ++i) {
+        values.push_back(parser::parse(json_str));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  parse: " << (g_allocation_bytes.load() - bytes) / 1024 << " KB in "
+              << g_allocation_count.load() - count << " allocations, "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << "ms" << std::endl;
+
+    auto                  pool = std::make_shared<StringPool>();
+    std::vector<Document> interned;
+    bytes = g_allocation_bytes.load();
+    count = g_allocation_count.load();
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < documents; ++i) {
+        interned.push_back(parser::parseInterned(json_str, pool));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "  parseInterned: " << (g_allocation_bytes.load() - bytes) / 1024 << " KB in "
+              << g_allocation_count.load() - count << " allocations, "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << "ms" << std::endl;
+
+    const StringPool::Stats& stats = pool->stats();
+    std::cout << "  pool: " << stats.strings << " strings (" << stats.bytes / 1024 << " KB), "
+              << stats.hits << "/" << stats.lookups << " lookups deduplicated, "
+              << stats.savedBytes / 1024 << " KB saved" << std::endl;
+
+    if (parser::stringify(interned.back().root()) != parser::stringify(values.back())) {
+        throw std::runtime_error("interned parse result mismatch");
+    }
+}
+
+// 测试只校验不构建 DOM 的 validate：同时检查 UTF-8，且不分配内存
+void test_ccjson_validate_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson validate (" << iterations << " iterations)..." << std::endl;
+
+    auto parse_mode = [&](int mode) {
+        if (mode == 0) {
+            JsonValue value = parser::parse(json_str);
+        } else if (!parser::validate(json_str)) {
+            throw std::runtime_error("validate rejected valid input");
+        }
+    };
+    const char* names[] = {"parse", "validate"};
+
+    long long durations[2] = {};
+    for (int mode = 0; mode < 2; ++mode) {
+        // 第一次调用用于预热解析器内部复用的栈
+        parse_mode(mode);
+        size_t before = g_allocation_count.load();
+        parse_mode(mode);
+        size_t allocations = g_allocation_count.load() - before;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            parse_mode(mode);
+        }
+        auto end        = std::chrono::high_resolution_clock::now();
+        auto duration   = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        durations[mode] = duration.count();
+
+        double seconds = static_cast<double>(durations[mode]) / 1e6;
+        double mb      = static_cast<double>(json_str.size()) * iterations / 1024.0 / 1024.0;
+        std::cout << "  " << names[mode] << ": " << allocations << " allocations, "
+                  << durations[mode] / 1000 << "ms, " << mb / seconds << " MB/s" << std::endl;
+        if (mode == 1 && allocations != 0) {
+            throw std::runtime_error("validate allocated memory");
+        }
+    }
+    std::cout << "  speedup: " << static_cast<double>(durations[0]) / durations[1] << "x"
+              << std::endl;
+
+    // 截断的输入和字符串中无效的 UTF-8 都必须被拒绝（后者 parse 不检查）
+    std::string invalid = json_str;
+    invalid[invalid.find("\"text\"") + 1] = '\xff';
+    if (parser::validate(json_str.substr(0, json_str.size() / 2)) || parser::validate(invalid)) {
+        throw std::runtime_error("validate accepted invalid input");
+    }
+}
+
+// 测试从文件解析：先读入字符串再解析 vs parseFile vs 映射文件后零拷贝解析
+void test_ccjson_parse_file_performance(const std::string& filename, int iterations) {
+    std::cout << "Testing ccjson parse from file (" << iterations << " iterations)..."
+              << std::endl;
+
+    auto parse_mode = [&](int mode) {
+        if (mode == 0) {
+            std::ifstream file(filename);
+            std::string   json_str((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
+            JsonValue     value = parser::parse(json_str);
+        } else if (mode == 1) {
+            JsonValue value = parser::parse(read_file(filename));
+        } else if (mode == 2) {
+            JsonValue value = parser::parseFile(filename);
+        } else {
+            Document document = parser::parseDocumentFile(filename);
+        }
+    };
+    const char* names[] = {
+        "istreambuf_iterator + parse", "rdbuf + parse", "parseFile", "parseDocumentFile"};
+
+    for (int mode = 0; mode < 4; ++mode) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            parse_mode(mode);
+        }
+        auto end      = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        std::cout << "  " << names[mode] << ": " << duration.count() << "ms" << std::endl;
+    }
+
+    std::string expected = parser::stringify(parser::parse(read_file(filename)));
+    if (parser::stringify(parser::parseFile(filename)) != expected ||
+        parser::stringify(parser::parseDocumentFile(filename).root()) != expected) {
+        throw std::runtime_error("parse from file result mismatch");
+    }
+}
+
+// 测试延迟数字解析：数字只校验不转换，序列化时原样输出原始文本
+void test_ccjson_lazy_number_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson lazy number parse (" << iterations << " iterations)..."
+              << std::endl;
+
+    // parse 中超过 14 字节的浮点数文本需要单独分配，parseDocument 中直接引用输入，两者分别对比
+    std::string_view input(json_str);
+    auto             parse_mode = [&](int mode) {
+        auto option = mode % 2 == 0 ? parser::DISABLE_EXTENSION : parser::ENABLE_LAZY_NUMBER;
+        if (mode < 2) {
+            JsonValue value = parser::parse(input, option);
+        } else {
+            Document document = parser::parseDocument(input, nullptr, option);
+        }
+    };
+    const char* names[] = {"parse", "parse lazy", "parseDocument", "parseDocument lazy"};
+
+    for (int mode = 0; mode < 4; ++mode) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            parse_mode(mode);
+        }
+        auto end      = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        double seconds = static_cast<double>(duration.count()) / 1e6;
+        double mb      = static_cast<double>(json_str.size()) * iterations / 1024.0 / 1024.0;
+        std::cout << "  " << names[mode] << ": " << duration.count() / 1000 << "ms, "
+                  << mb / seconds << " MB/s" << std::endl;
+    }
+
+    // 原样输出的数字重新解析后必须与立即转换的结果完全一致
+    JsonValue   lazy     = parser::parse(input, parser::ENABLE_LAZY_NUMBER);
+    std::string expected = parser::stringify(parser::parse(input));
+    if (parser::stringify(parser::parse(parser::stringify(lazy))) != expected) {
+        throw std::runtime_error("lazy number roundtrip mismatch");
+    }
+
+    // 值内部保存的短文本、直接转换的长整数、超出 int64_t 的整数与长浮点数都原样输出
+    const std::string numbers =
+        "[-0,1.50,1E+05,12345678901234,-9223372036854775808,"
+        "12345678901234567890123,-65.613616999999977,0.1000000000000000055511]";
+    if (parser::stringify(parser::parse(numbers, parser::ENABLE_LAZY_NUMBER)) != numbers) {
+        throw std::runtime_error("lazy number text mismatch");
+    }
+}
+
+// 测试按需解析：只读取少量字段时与完整解析后再用 operator[] 查找的对比（字段按文档中的顺序访问）
+void test_ccjson_ondemand_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson on-demand sparse access (" << iterations << " iterations)..."
+              << std::endl;
+
+    int64_t dom_sum = 0, ondemand_sum = 0;
+    auto    start   = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        JsonValue value = parser::parse(json_str);
+        dom_sum += value["statuses"][0]["user"]["id"].get<int64_t>();
+        dom_sum += value["statuses"][50]["retweet_count"].get<int64_t>();
+        dom_sum += static_cast<int64_t>(value["statuses"][99]["text"].get<std::string>().size());
+        dom_sum += value["search_metadata"]["count"].get<int64_t>();
+    }
+    auto end      = std::chrono::high_resolution_clock::now();
+    auto dom_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        parser::ondemand::Document document(json_str);
+        ondemand_sum += document["statuses"][0]["user"]["id"].get<int64_t>();
+        ondemand_sum += document["statuses"][50]["retweet_count"].get<int64_t>();
+        ondemand_sum += static_cast<int64_t>(
+            document["statuses"][99]["text"].get<std::string_view>().size());
+        ondemand_sum += document["search_metadata"]["count"].get<int64_t>();
+    }
+    end                = std::chrono::high_resolution_clock::now();
+    auto ondemand_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "  parse + operator[]: " << dom_time.count() / 1000 << "ms" << std::endl;
+    std::cout << "  ondemand: " << ondemand_time.count() / 1000 << "ms ("
+              << static_cast<double>(dom_time.count()) / static_cast<double>(ondemand_time.count())
+              << "x)" << std::endl;
+    if (dom_sum != ondemand_sum) {
+        throw std::runtime_error("on-demand access result mismatch");
+    }
+
+    // 读取根节点时与 parse 相同地拒绝之后的多余内容，根节点之后的空白字符是允许的
+    auto rejects = [](const char* json, bool as_view) {
+        parser::ondemand::Document document(json);
+        try {
+            if (as_view) {
+                document.root().get<std::string_view>();
+            } else {
+                document.root().get<JsonValue>();
+            }
+        } catch (const JsonParseException&) {
+            return true;
+        }
+        return false;
+    };
+    if (!rejects("{\"a\":1}u", false) || !rejects("[1,2] 3", false) || !rejects("12 x", false) ||
+        !rejects("\"text\"x", false) || !rejects("\"text\" x", true)) {
+        throw std::runtime_error("on-demand root accepted trailing content");
+    }
+    parser::ondemand::Document padded(" {\"a\":\"b\"} \n");
+    if (padded.root().get<JsonValue>()["a"].asStringView() != "b" ||
+        padded["a"].get<std::string_view>() != "b") {
+        throw std::runtime_error("on-demand root rejected trailing whitespace");
+    }
+
+    // 重复查找同一个键以及向前查找时，从头查找的一轮要包括上一次找到的成员
+    parser::ondemand::Document members("{\"a\":1,\"b\":2,\"c\":3,\"c\":4,\"d\":5}");
+    int64_t                    lookups = 0;
+    for (const char* key : {"a", "a", "b", "b", "d", "b", "a", "d", "d"}) {
+        lookups = lookups * 10 + members[key].get<int64_t>();
+    }
+    if (lookups != 112252155) {
+        throw std::runtime_error("on-demand repeated key lookup mismatch");
+    }
+}
+
+// SAX 统计：只累计节点数、整数之和与字符串长度，不保存任何值
+struct CountingHandler : JsonHandler {
+    size_t  nodes       = 0;
+    int64_t integer_sum = 0;
+    size_t  string_size = 0;
+    bool    stop_at_id  = false;  // 遇到第一个 "id" 键后停止
+
+    bool onNull() override {
+        return ++nodes, true;
+    }
+    bool onBool(bool) override {
+        return ++nodes, true;
+    }
+    bool onInt64(int64_t value) override {
+        integer_sum += value;
+        return ++nodes, true;
+    }
+    bool onDouble(double) override {
+        return ++nodes, true;
+    }
+    bool onString(std::string_view value) override {
+        string_size += value.size();
+        return ++nodes, true;
+    }
+    bool onKey(std::string_view key) override {
+        return !(stop_at_id && key == "id");
+    }
+    bool onStartObject() override {
+        return ++nodes, true;
+    }
+    bool onStartArray() override {
+        return ++nodes, true;
+    }
+};
+
+// 遍历 DOM 累计与 CountingHandler 相同的统计量，用于校验 SAX 事件
+void count_dom(const JsonValue& value, CountingHandler& stats) {
+    stats.nodes++;
+    switch (value.type()) {
+        case JsonType::Integer: stats.integer_sum += value.get<int64_t>(); break;
+        case JsonType::String: stats.string_size += value.asStringView().size(); break;
+        case JsonType::Array:
+            for (const auto& item : value.asArray()) {
+                count_dom(item, stats);
+            }
+            break;
+        case JsonType::Object:
+            for (const auto& [key, item] : value.asObject()) {
+                count_dom(item, stats);
+            }
+            break;
+        default: break;
+    }
+}
+
+// 测试投影解析：只构建少量路径，其余子树整体跳过
+void test_ccjson_projection_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson projected parse (" << iterations << " iterations)..."
+              << std::endl;
+
+    const parser::Projection projection{"/statuses/*/id", "/statuses/*/user/screen_name",
+                                        "/statuses/*/entities/hashtags",
+                                        "/search_metadata/count"};
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        JsonValue value = parser::parse(json_str);
+    }
+    auto end       = std::chrono::high_resolution_clock::now();
+    auto full_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        JsonValue value = parser::parseProjected(json_str, projection);
+    }
+    end                  = std::chrono::high_resolution_clock::now();
+    auto projection_time = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "  parse: " << full_time.count() / 1000 << "ms" << std::endl;
+    std::cout << "  parseProjected: " << projection_time.count() / 1000 << "ms ("
+              << static_cast<double>(full_time.count()) /
+                     static_cast<double>(projection_time.count())
+              << "x)" << std::endl;
+
+    // 选中的值必须与完整解析的结果相同，未选中的成员不出现在结果中
+    JsonValue full      = parser::parse(json_str);
+    JsonValue projected = parser::parseProjected(json_str, projection);
+    const JsonArray& statuses = full["statuses"].asArray();
+    for (size_t i = 0; i < statuses.size(); ++i) {
+        const JsonValue&  expected = statuses[i];
+        const JsonObject& actual   = projected["statuses"][i].asObject();
+        if (actual.size() != 3 || actual.at("user").asObject().size() != 1 ||
+            actual.at("id").toString() != expected["id"].toString() ||
+            actual.at("user")["screen_name"].toString() !=
+                expected["user"]["screen_name"].toString() ||
+            actual.at("entities")["hashtags"].toString() !=
+                expected["entities"]["hashtags"].toString()) {
+            throw std::runtime_error("projected parse result mismatch");
+        }
+    }
+    if (projected["search_metadata"]["count"].toString() !=
+        full["search_metadata"]["count"].toString()) {
+        throw std::runtime_error("projected parse result mismatch");
+    }
+
+    // 重复的键与 parse 相同地保留第一次出现的成员，包括第一次出现的值类型与路径不符的情况
+    const struct {
+        const char* json;
+        const char* path;
+        const char* expected;
+    } duplicates[] = {
+        {R"({"a":1,"a":2})", "/a", R"({"a":1})"},
+        {R"({"b":{"c":1},"b":{"c":2}})", "/b/c", R"({"b":{"c":1}})"},
+        {R"({"b":{"d":1},"b":{"c":2}})", "/b/c", R"({"b":{}})"},
+        {R"({"b":1,"b":{"c":2}})", "/b/c", "{}"},
+        {R"({"b":"x","b":{"c":2},"b":[3]})", "/b/c", "{}"},
+        {R"({"b":[5],"b":{"c":1}})", "/b/c", R"({"b":[null]})"},
+        {R"({"s":[{"b":1,"b":{"c":2}},{"b":{"c":3}}]})",
+         "/s/*/b/c",
+         R"({"s":[{},{"b":{"c":3}}]})"},
+    };
+    for (const auto& test : duplicates) {
+        if (parser::parseProjected(test.json, {test.path}).toString() != test.expected) {
+            throw std::runtime_error(std::string("projected duplicate key mismatch: ") + test.json);
+        }
+    }
+}
+
+// 收集文档中成员数不少于 min_size 的对象
+void collect_objects(const JsonValue& value, size_t min_size, std::vector<const JsonObject*>& objects) {
+    if (value.isArray()) {
+        for (const auto& item : value.asArray()) {
+            collect_objects(item, min_size, objects);
+        }
+    } else if (value.isObject()) {
+        if (value.asObject().size() >= min_size) {
+            objects.push_back(&value.asObject());
+        }
+        for (const auto& [key, item] : value.asObject()) {
+            collect_objects(item, min_size, objects);
+        }
+    }
+}
+
+// 测试扁平对象的查找、遍历与内存占用，与原先每个成员一个红黑树节点的 std::map 对比
+void test_ccjson_object_performance(const std::string& json_str, int iterations) {
+    using MapObject = std::map<JsonObjectKey, JsonValue, std::less<>>;
+
+    JsonValue                      root = parser::parse(json_str);
+    std::vector<const JsonObject*> objects;
+    collect_objects(root, 20, objects);
+    std::cout << "Testing ccjson object lookup (" << objects.size() << " objects with 20+ members, "
+              << iterations << " iterations)..." << std::endl;
+
+    // 值一律用 null 代替，只比较成员存储本身的内存占用
+    std::vector<JsonObject> flat(objects.size());
+    std::vector<MapObject>  maps(objects.size());
+    size_t                  bytes = g_allocation_bytes.load();
+    size_t                  count = g_allocation_count.load();
+    for (size_t i = 0; i < objects.size(); ++i) {
+        for (const auto& [key, item] : *objects[i]) {
+            maps[i].try_emplace(key);
+        }
+    }
+    std::cout << "  std::map: " << (g_allocation_bytes.load() - bytes) / 1024 << " KB in "
+              << g_allocation_count.load() - count << " allocations" << std::endl;
+    bytes = g_allocation_bytes.load();
+    count = g_allocation_count.load();
+    for (size_t i = 0; i < objects.size(); ++i) {
+        flat[i].reserve(objects[i]->size());
+        for (const auto& [key, item] : *objects[i]) {
+            flat[i].try_emplace(key);
+        }
+    }
+    std::cout << "  JsonObject: " << (g_allocation_bytes.load() - bytes) / 1024 << " KB in "
+              << g_allocation_count.load() - count << " allocations" << std::endl;
+
+    std::vector<std::vector<std::string>> keys(objects.size());
+    size_t                                lookups = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        for (const auto& [key, item] : *objects[i]) {
+            keys[i].push_back(key.str());
+        }
+        lookups += keys[i].size();
+    }
+
+    // mode 0/1: 按键查找所有成员；mode 2/3: 遍历所有成员
+    auto run_mode = [&](int mode) {
+        size_t found = 0;
+        for (size_t i = 0; i < objects.size(); ++i) {
+            if (mode == 0) {
+                for (const auto& key : keys[i]) {
+                    found += maps[i].find(std::string_view(key)) != maps[i].end() ? 1 : 0;
+                }
+            } else if (mode == 1) {
+                for (const auto& key : keys[i]) {
+                    found += flat[i].find(key) != flat[i].end() ? 1 : 0;
+                }
+            } else if (mode == 2) {
+                for (const auto& [key, item] : maps[i]) {
+                    found += key.size();
+                }
+            } else {
+                for (const auto& [key, item] : flat[i]) {
+                    found += key.size();
+                }
+            }
+        }
+        return found;
+    };
+    const char* names[] = {"std::map find", "JsonObject find", "std::map iterate",
+                           "JsonObject iterate"};
+
+    double times[4] = {};
+    size_t found[4] = {};
+    for (int mode = 0; mode < 4; ++mode) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            found[mode] = run_mode(mode);
+        }
+        auto end    = std::chrono::high_resolution_clock::now();
+        auto total  = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        times[mode] = static_cast<double>(total) / iterations / static_cast<double>(lookups);
+        std::cout << "  " << names[mode] << ": " << times[mode] << " ns/member";
+        if (mode % 2 == 1) {
+            std::cout << " (" << times[mode - 1] / times[mode] << "x)";
+        }
+        std::cout << std::endl;
+    }
+
+    if (found[0] != lookups || found[1] != lookups || found[2] != found[3]) {
+        throw std::runtime_error("object lookup result mismatch");
+    }
+}
+
+// 生成 count 个 16 字节的键：在固定种子 0x9e3779b97f4a7c15 的哈希下完全冲突，
+// 第二个 8 字节由第一个 8 字节混合后的状态推出（只保留所有字节都是 ASCII 的键）
+std::string generate_colliding_object(size_t count) {
+    std::string json = "{";
+    for (uint64_t i = 0, made = 0; made < count; ++i) {
+        char     key[16];
+        uint64_t x = i;
+        for (int b = 0; b < 8; ++b, x /= 26) {
+            key[b] = static_cast<char>('a' + x % 26);
+        }
+        uint64_t word;
+        std::memcpy(&word, key, 8);
+        uint64_t state = ((0x9e3779b97f4a7c15ULL ^ 16) ^ word) * 0xff51afd7ed558ccdULL;
+        state ^= state >> 32;
+        const uint64_t tail = state ^ 0x4141414141414141ULL;
+        if (tail & 0x8080808080808080ULL) {
+            continue;
+        }
+        std::memcpy(key + 8, &tail, 8);
+        json += made++ == 0 ? "\"" : ",\"";
+        for (char c : key) {
+            if (c < 0x20 || c == '"' || c == '\\') {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                json += escaped;
+            } else {
+                json += c;
+            }
+        }
+        json += "\":0";
+    }
+    return json + "}";
+}
+
+// 测试大对象的哈希索引：攻击者构造的冲突键不能使解析退化为平方复杂度，
+// 逐个删除成员时只调整索引而不重新计算所有键的哈希值
+void test_ccjson_object_index_robustness(size_t members) {
+    std::cout << "Testing ccjson object index robustness (" << members << " members)..."
+              << std::endl;
+
+    std::string ordinary = "{";
+    for (size_t i = 0; i < members; ++i) {
+        ordinary += (i == 0 ? "\"key_" : ",\"key_") + std::to_string(i) + "_padding\":0";
+    }
+    ordinary += "}";
+    const std::string hostile = generate_colliding_object(members);
+
+    double times[2] = {};
+    for (int mode = 0; mode < 2; ++mode) {
+        auto      start  = std::chrono::high_resolution_clock::now();
+        JsonValue value  = parser::parse(mode == 0 ? ordinary : hostile);
+        auto      end    = std::chrono::high_resolution_clock::now();
+        times[mode]      = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        std::cout << "  " << (mode == 0 ? "ordinary keys" : "colliding keys") << ": "
+                  << times[mode] / 1000 << "ms" << std::endl;
+        if (value.asObject().size() != members) {
+            throw std::runtime_error("object index member count mismatch");
+        }
+    }
+    // 固定种子下冲突的键相对普通键要慢上百倍
+    if (times[1] > times[0] * 20 + 1000) {
+        throw std::runtime_error("colliding keys degrade object parse");
+    }
+
+    // 每 20 个成员删除一个，剩余成员仍然可以查找到（删除需要移动其后的成员，与 std::vector 相同）
+    JsonValue   value  = parser::parse(ordinary);
+    JsonObject& object = value.asObject();
+    auto        start  = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < members; i += 20) {
+        object.erase("key_" + std::to_string(i) + "_padding");
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  erase " << members / 20 << " members: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms"
+              << std::endl;
+    for (size_t i = 0; i < members; ++i) {
+        const bool present = object.contains("key_" + std::to_string(i) + "_padding");
+        if (present != (i % 20 != 0)) {
+            throw std::runtime_error("object erase left the index inconsistent");
+        }
+    }
+}
+
+// 测试热点键的查找：字符串字面量与 std::string_view 直接查找而不构造临时的键，
+// JsonKey 还省去了计算哈希值；所有方式都不应分配内存
+void test_ccjson_key_lookup_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson hot key lookup (" << iterations << " iterations)..." << std::endl;
+
+    const JsonValue  root     = parser::parse(json_str);
+    const JsonValue& statuses = root["statuses"];
+    const char*      names[]  = {"id", "text", "user", "retweet_count", "favorite_count", "lang",
+                                 "created_at", "in_reply_to_status_id_str"};
+    std::vector<std::string_view> views(std::begin(names), std::end(names));
+    std::vector<JsonKey>          keys;
+    for (const char* name : names) {
+        keys.emplace_back(name);
+    }
+
+    auto run_mode = [&](int mode) {
+        size_t found = 0;
+        for (const auto& status : statuses.asArray()) {
+            for (size_t k = 0; k < keys.size(); ++k) {
+                const JsonValue& value = mode == 0   ? status[names[k]]
+                                         : mode == 1 ? status[views[k]]
+                                                     : status[keys[k]];
+                found += value.isNull() ? 0 : 1;
+            }
+        }
+        return found;
+    };
+    const char* modes[] = {"const char*", "std::string_view", "JsonKey"};
+
+    size_t lookups  = statuses.asArray().size() * keys.size();
+    size_t found[3] = {};
+    for (int mode = 0; mode < 3; ++mode) {
+        size_t count = g_allocation_count.load();
+        auto   start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            found[mode] = run_mode(mode);
+        }
+        auto end         = std::chrono::high_resolution_clock::now();
+        auto total       = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        size_t allocated = g_allocation_count.load() - count;
+        std::cout << "  " << modes[mode] << ": "
+                  << static_cast<double>(total) / iterations / static_cast<double>(lookups)
+                  << " ns/lookup, " << allocated << " allocations" << std::endl;
+        if (allocated != 0) {
+            throw std::runtime_error("key lookup allocated memory");
+        }
+    }
+
+    if (found[0] != found[1] || found[0] != found[2]) {
+        throw std::runtime_error("key lookup result mismatch");
+    }
+}
+
+// 测试读取可选字段：值为 null 或键不存在时，operator[] 与 get<T>() 抛出异常，
+// find/try_get 与 value_or 只查找一次且不抛出异常
+void test_ccjson_optional_access_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson optional field access (" << iterations << " iterations)..."
+              << std::endl;
+
+    const JsonValue  root     = parser::parse(json_str);
+    const JsonValue& statuses = root["statuses"];
+    // 大多为 null、部分缺失或总是存在的字段
+    const char* names[] = {"in_reply_to_status_id", "in_reply_to_user_id", "possibly_sensitive",
+                           "retweet_count", "favorite_count"};
+
+    auto run_mode = [&](int mode) {
+        int64_t sum = 0;
+        for (const auto& status : statuses.asArray()) {
+            for (const char* name : names) {
+                if (mode == 0) {
+                    try {
+                        sum += status[name].get<int64_t>();
+                    } catch (const JsonException&) {
+                    }
+                } else if (mode == 1) {
+                    if (const JsonValue* member = status.find(name)) {
+                        sum += member->try_get<int64_t>().value_or(0);
+                    }
+                } else {
+                    sum += status.value_or(name, int64_t{0});
+                }
+            }
+        }
+        return sum;
+    };
+    const char* modes[] = {"operator[] + try/catch", "find + try_get", "value_or"};
+
+    double  durations[3] = {};
+    int64_t sums[3]      = {};
+    for (int mode = 0; mode < 3; ++mode) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            sums[mode] = run_mode(mode);
+        }
+        auto end        = std::chrono::high_resolution_clock::now();
+        durations[mode] = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        std::cout << "  " << modes[mode] << ": " << durations[mode] / iterations << " us/pass";
+        if (mode != 0) {
+            std::cout << " (" << durations[0] / durations[mode] << "x)";
+        }
+        std::cout << std::endl;
+    }
+
+    if (sums[0] != sums[1] || sums[0] != sums[2]) {
+        throw std::runtime_error("optional field access result mismatch");
+    }
+}
+
+// 测试 SAX 解析：与构建 DOM 使用同一个词法分析器，但不为节点分配内存
+void test_ccjson_sax_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson SAX parse (" << iterations << " iterations)..." << std::endl;
+
+    for (int mode = 0; mode < 2; ++mode) {
+        CountingHandler handler;
+        size_t          before = g_allocation_count.load();
+        if (mode == 0) {
+            JsonValue value = parser::parse(json_str);
+        } else {
+            parser::parse(json_str, handler);
+        }
+        size_t allocations = g_allocation_count.load() - before;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            if (mode == 0) {
+                JsonValue value = parser::parse(json_str);
+            } else {
+                parser::parse(json_str, handler);
+            }
+        }
+        auto end      = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        double seconds = static_cast<double>(duration.count()) / 1e6;
+        double mb      = static_cast<double>(json_str.size()) * iterations / 1024.0 / 1024.0;
+        std::cout << "  " << (mode == 0 ? "parse (DOM)" : "parse (SAX)") << ": " << allocations
+                  << " allocations, " << duration.count() / 1000 << "ms, " << mb / seconds
+                  << " MB/s" << std::endl;
+    }
+
+    // 提前停止：只读到第一个 "id" 键
+    CountingHandler early;
+    early.stop_at_id = true;
+    auto start       = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        parser::parse(json_str, early);
+    }
+    auto end      = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    std::cout << "  parse (SAX, stop at first \"id\"): " << duration.count() << "us" << std::endl;
+
+    // 重复键在 DOM 中只保留第一次出现的值，测试数据中没有重复键，两者的统计应当一致
+    CountingHandler sax, dom;
+    if (!parser::parse(json_str, sax)) {
+        throw std::runtime_error("SAX parse stopped unexpectedly");
+    }
+    count_dom(parser::parse(json_str), dom);
+    if (sax.nodes != dom.nodes || sax.integer_sum != dom.integer_sum ||
+        sax.string_size != dom.string_size) {
+        throw std::runtime_error("SAX event statistics mismatch");
+    }
+}
+
+// 测试增量解析：输入按固定大小分块送入（模拟从网络分段读取），与一次性解析完整输入对比
+void test_ccjson_push_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson push parser (" << iterations << " iterations)..." << std::endl;
+
+    const size_t chunk_sizes[] = {0, 4 * 1024, 64 * 1024};  // 0 表示一次性解析
+    for (size_t chunk_size : chunk_sizes) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            if (chunk_size == 0) {
+                JsonValue value = parser::parse(json_str);
+                continue;
+            }
+            parser::PushParser push;
+            for (size_t offset = 0; offset < json_str.size(); offset += chunk_size) {
+                push.feed(std::string_view(json_str).substr(offset, chunk_size));
+            }
+            push.finish();
+        }
+        auto end      = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        double seconds = static_cast<double>(duration.count()) / 1e6;
+        double mb      = static_cast<double>(json_str.size()) * iterations / 1024.0 / 1024.0;
+        if (chunk_size == 0) {
+            std::cout << "  parse (whole input): ";
+        } else {
+            std::cout << "  PushParser (" << chunk_size / 1024 << " KB chunks): ";
+        }
+        std::cout << duration.count() / 1000 << "ms, " << mb / seconds << " MB/s" << std::endl;
+    }
+
+    // 块边界落在字符串、转义序列和数字中间时结果也必须与一次性解析相同
+    std::string        expected = parser::stringify(parser::parse(json_str));
+    parser::PushParser push;
+    for (size_t offset = 0; offset < json_str.size(); offset += 7) {
+        push.feed(std::string_view(json_str).substr(offset, 7));
+    }
+    push.finish();
+    if (parser::stringify(push.root()) != expected) {
+        throw std::runtime_error("push parser result mismatch");
+    }
+
+    // 非法的 \u、\x 转义以及在容器中结束的输入逐字节输入时，错误信息和位置必须与 parse 相同
+    auto error_of = [](auto&& run) -> std::string {
+        try {
+            run();
+            return "ok";
+        } catch (const JsonParseException& e) {
+            return e.message() + " @" + std::to_string(e.position());
+        }
+    };
+    const char* malformed[] = {
+        R"(["\u12"])",           R"(["\u12"]   )",      R"(["\u"])",      R"(["\u1)",
+        R"({"\u12":1})",         R"(["\uzzzz"])",       R"(["\ud800"])",  R"(["\ud800\u12"])",
+        R"(["\ud800\udz00",1])", R"(["\ud800\u0041"])", R"(["\ud800\)",   R"(["\ud800\"]")",
+        R"(["\u00e9\u"])",       R"(["\x4"])",          R"(["\x41\x4"])", R"(["\x"] )",
+        R"(["\xe2\x82"])",       R"(["\q"])",           R"(["\u0041"])",  R"(["\ud83d\ude00"])",
+        R"({"\x00\x"])",         R"(["]\x4a\x"])",      R"([1, )",        R"({"a":1 )",
+        R"({"a":1, )",           R"({"a" )",            R"([ )",          R"({"a": )",
+    };
+    const parser::ParserOption options[] = {parser::DISABLE_EXTENSION,
+                                            parser::ENABLE_PARSE_X_ESCAPE_SEQUENCE};
+    for (parser::ParserOption option : options) {
+        for (const char* text : malformed) {
+            const std::string_view input(text);
+            const std::string      parsed = error_of([&] { parser::parse(input, option); });
+            const std::string      pushed = error_of([&] {
+                parser::PushParser bytes(option);
+                for (char c : input) {
+                    bytes.feed(std::string_view(&c, 1));
+                }
+                bytes.finish();
+            });
+            if (pushed != parsed) {
+                throw std::runtime_error("push parser error mismatch on " + std::string(input) +
+                                         ": " + pushed + " vs " + parsed);
+            }
+        }
+    }
+}
+
+// 由 twitter.json 中的 statuses 重复生成 NDJSON（每行一条记录）
+std::string generate_ndjson(const std::string& json_str, size_t target_size) {
+    JsonValue   value = parser::parse(json_str);
+    std::string lines;
+    for (const auto& status : value["statuses"].asArray()) {
+        lines += status.toString();
+        lines += '\n';
+    }
+    std::string result;
+    result.reserve(target_size + lines.size());
+    while (result.size() < target_size) {
+        result += lines;
+    }
+    return result;
+}
+
+// 测试 NDJSON 并行解析的吞吐量随线程数的变化
+void test_ccjson_ndjson_performance(const std::string& ndjson_str) {
+    std::cout << "Testing ccjson parseNdjson (" << ndjson_str.size() / 1024 / 1024 << " MB, "
+              << std::thread::hardware_concurrency() << " hardware threads)..." << std::endl;
+
+    // 单线程逐行调用 parse 作为基准
+    size_t expected = 0;
+    auto   start    = std::chrono::high_resolution_clock::now();
+    for (size_t begin = 0, end; begin < ndjson_str.size(); begin = end + 1) {
+        end = ndjson_str.find('\n', begin);
+        if (end == std::string::npos) {
+            end = ndjson_str.size();
+        }
+        JsonValue value = parser::parse(std::string_view(ndjson_str).substr(begin, end - begin));
+        expected++;
+    }
+    auto   end      = std::chrono::high_resolution_clock::now();
+    auto   duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    double mb       = static_cast<double>(ndjson_str.size()) / 1024.0 / 1024.0;
+    std::cout << "  parse per line (1 thread): " << mb / (duration.count() / 1e6) << " MB/s"
+              << std::endl;
+
+    for (bool ordered : {true, false}) {
+        for (size_t threads : {1, 2, 4, 8}) {
+            parser::NdjsonOptions options;
+            options.threads = threads;
+            options.ordered = ordered;
+            std::atomic<size_t> records{0};
+            start        = std::chrono::high_resolution_clock::now();
+            size_t count = parser::parseNdjson(
+                ndjson_str, [&](size_t, JsonValue&&) { records++; }, options);
+            end      = std::chrono::high_resolution_clock::now();
+            duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+            std::cout << "  parseNdjson (" << (ordered ? "ordered" : "unordered") << ", "
+                      << threads << " threads): " << mb / (duration.count() / 1e6) << " MB/s"
+                      << std::endl;
+            if (count != expected || records != expected) {
+                throw std::runtime_error("parseNdjson record count mismatch");
+            }
+        }
+    }
+
+    // 按顺序回调时，出错行之前的记录都必须回调，即使之后的批先出错
+    std::string malformed = ndjson_str;
+    size_t      bad_line  = expected / 2;
+    size_t      bad_pos   = 0;
+    for (size_t i = 0; i < bad_line; ++i) {
+        bad_pos = malformed.find('\n', bad_pos) + 1;
+    }
+    malformed[bad_pos] = '@';
+    for (size_t threads : {2, 4, 8}) {
+        parser::NdjsonOptions options;
+        options.threads   = threads;
+        options.ordered   = true;
+        options.batchSize = 4096;
+        size_t delivered  = 0;
+        try {
+            parser::parseNdjson(
+                malformed,
+                [&](size_t line, JsonValue&&) {
+                    if (line != delivered++) {
+                        throw std::runtime_error("parseNdjson delivered records out of order");
+                    }
+                },
+                options);
+        } catch (const JsonParseException&) {
+        }
+        if (delivered != bad_line) {
+            throw std::runtime_error("parseNdjson dropped records before the malformed line");
+        }
+    }
+}
+
+// 由 twitter.json 中的 statuses 重复生成一个大数组
+std::string generate_large_array(const std::string& json_str, size_t target_size) {
+    JsonValue   value = parser::parse(json_str);
+    std::string elements;
+    for (const auto& status : value["statuses"].asArray()) {
+        elements += status.toString();
+        elements += ",\n";
+    }
+    std::string result = "[";
+    result.reserve(target_size + elements.size());
+    while (result.size() < target_size) {
+        result += elements;
+    }
+    // 去掉最后一个元素之后的逗号
+    result[result.size() - 2] = '\n';
+    result.back()             = ']';
+    return result;
+}
+
+// 测试大数组并行解析的耗时随线程数的变化
+void test_ccjson_parallel_performance(const std::string& array_str) {
+    std::cout << "Testing ccjson parseParallel (" << array_str.size() / 1024 / 1024 << " MB, "
+              << std::thread::hardware_concurrency() << " hardware threads)..." << std::endl;
+
+    // 单线程 parse 作为基准
+    double    mb       = static_cast<double>(array_str.size()) / 1024.0 / 1024.0;
+    auto      start    = std::chrono::high_resolution_clock::now();
+    JsonValue value    = parser::parse(array_str);
+    auto      end      = std::chrono::high_resolution_clock::now();
+    auto      baseline = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    auto      expected = parser::stringify(value);
+    std::cout << "  parse: " << baseline.count() / 1000 << "ms, "
+              << mb / (baseline.count() / 1e6) << " MB/s" << std::endl;
+
+    for (size_t threads : {1, 2, 4, 8}) {
+        parser::ParallelOptions options;
+        options.threads  = threads;
+        start            = std::chrono::high_resolution_clock::now();
+        JsonValue result = parser::parseParallel(array_str, options);
+        end              = std::chrono::high_resolution_clock::now();
+        auto duration    = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        std::cout << "  parseParallel (" << threads << " threads): " << duration.count() / 1000
+                  << "ms, " << mb / (duration.count() / 1e6) << " MB/s ("
+                  << static_cast<double>(baseline.count()) / duration.count() << "x)" << std::endl;
+        if (parser::stringify(result) != expected) {
+            throw std::runtime_error("parseParallel result mismatch");
+        }
+    }
+
+    // 片或数组末尾的元素之后紧跟非法字符时，异常应与 parse 相同
+    const std::pair<const char*, const char*> malformed[] = {
+        {"[1,2,3x]", ""},
+        {"[1,2x,3]", ""},
+        {"[1,2,truefalse]", ""},
+        {"[\"a\",{}1,[]]", ""},
+        {"{\"data\":[1,2,3x]}", "/data"},
+    };
+    for (const auto& [json, path] : malformed) {
+        parser::ParallelOptions options;
+        options.threads   = 2;
+        options.sliceSize = 1;
+        options.arrayPath = path;
+        std::string expected_error;
+        try {
+            parser::parse(json);
+        } catch (const JsonParseException& e) {
+            expected_error = e.what();
+        }
+        std::string error;
+        try {
+            parser::parseParallel(json, options);
+        } catch (const JsonParseException& e) {
+            error = e.what();
+        }
+        if (expected_error.empty() || error != expected_error) {
+            throw std::runtime_error(std::string("parseParallel accepted malformed input: ") + json);
+        }
+    }
+}
+
+// 测试不抛出异常的 tryParse：输入多为非法记录时，异常的开销占据主要部分
+void test_ccjson_try_parse_performance(const std::string& json_str, int iterations) {
+    std::cout << "Testing ccjson tryParse on malformed records (" << iterations
+              << " iterations)..." << std::endl;
+
+    // 从 twitter.json 中截取小段记录：截断、插入非法字符或缺少分隔符
+    std::vector<std::string> records;
+    for (size_t i = 0; i < 1000; ++i) {
+        std::string record = json_str.substr(0, 64 + i % 512);
+        if (i % 3 == 1) {
+            record[record.size() / 2] = '@';
+        } else if (i % 3 == 2) {
+            record += "}}]]";
+        }
+        records.push_back(std::move(record));
+    }
+
+    size_t errors = 0;
+    auto   start  = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const auto& record : records) {
+            try {
+                JsonValue value = parser::parse(record);
+            } catch (const JsonParseException&) {
+                errors++;
+            }
+        }
+    }
+    auto end      = std::chrono::high_resolution_clock::now();
+    auto throwing = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+    size_t failures = 0;
+    start           = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const auto& record : records) {
+            JsonValue  value;
+            ParseError error;
+            if (!parser::tryParse(record, value, error)) {
+                failures++;
+            }
+        }
+    }
+    end           = std::chrono::high_resolution_clock::now();
+    auto returned = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+    const double count = static_cast<double>(records.size()) * iterations;
+    std::cout << "  parse + catch: " << throwing.count() / count << " ns/record" << std::endl;
+    std::cout << "  tryParse: " << returned.count() / count << " ns/record ("
+              << static_cast<double>(throwing.count()) / returned.count() << "x)" << std::endl;
+
+    // 两种接口报告的错误必须一致
+    for (const auto& record : records) {
+        JsonValue  value;
+        ParseError error;
+        const bool ok = parser::tryParse(record, value, error);
+        try {
+            parser::parse(record);
+            if (!ok) {
+                throw std::runtime_error("tryParse rejected a valid record");
+            }
+        } catch (const JsonParseException& e) {
+            if (ok || e.message() != error.message() || e.position() != error.offset) {
+                throw std::runtime_error("tryParse error mismatch");
+            }
+        }
+    }
+    if (errors != failures) {
+        throw std::runtime_error("tryParse error count mismatch");
+    }
+}
+
+// 测试深层嵌套：不限制深度时解析、拷贝、序列化和析构都不能栈溢出
+void test_ccjson_deep_nesting(size_t depth) {
+    std::cout << "Testing ccjson deep nesting (" << depth << " levels)..." << std::endl;
+
+    // 数组与对象交替嵌套：[{"a":[{"a":...null...}]}]
+    std::string json;
+    for (size_t i = 0; i < depth; ++i) {
+        json += i % 2 == 0 ? "[" : "{\"a\":";
+    }
+    json += "null";
+    for (size_t i = depth; i-- > 0;) {
+        json += i % 2 == 0 ? ']' : '}';
+    }
+
+    // 默认的深度限制拒绝该输入
+    try {
+        parser::parse(json);
+        throw std::runtime_error("parse accepted input deeper than DEFAULT_MAX_DEPTH");
+    } catch (const JsonParseException& e) {
+        if (e.message() != "Maximum nesting depth exceeded") {
+            throw std::runtime_error("unexpected deep nesting error: " + e.message());
+        }
+    }
+
+    const parser::ParserOptions unlimited(parser::DISABLE_EXTENSION, 0);
+    auto                        start = std::chrono::high_resolution_clock::now();
+    {
+        JsonValue value = parser::parse(json, unlimited);
+        JsonValue copy  = value;
+        if (parser::stringify(copy) != json) {
+            throw std::runtime_error("deeply nested value does not round-trip");
+        }
+    }
+    {
+        Document document = parser::parseDocument(json, nullptr, {parser::ENABLE_ARENA, 0});
+        if (parser::stringify(document.root()) != json) {
+            throw std::runtime_error("deeply nested document does not round-trip");
+        }
+    }
+    auto end      = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    std::cout << "  parse + copy + stringify + destroy: " << duration.count() << " ms"
+              << std::endl;
+}
+
 // 测试nlohmann/json解析性能
 void test_nlohmann_parse_performance(const std::string& json_str, int iterations) {
     std::cout << "Testing nlohmann/json parse performance (" << iterations << " iterations)..."
@@ -396,6 +1840,24 @@ int main() {
         std::cout << "\n--- Parse Performance ---" << std::endl;
         test_ccjson_parse_performance(json_str, iterations);
         test_nlohmann_parse_performance(json_str, iterations);
+        test_ccjson_whitespace_performance(json_str, iterations);
+        test_ccjson_document_performance(json_str, iterations);
+        test_ccjson_validate_performance(json_str, iterations);
+        test_ccjson_intern_performance(json_str, 20);
+        test_ccjson_parse_file_performance("twitter.json", iterations);
+        test_ccjson_lazy_number_performance(json_str, iterations);
+        test_ccjson_ondemand_performance(json_str, iterations);
+        test_ccjson_projection_performance(json_str, iterations);
+        test_ccjson_object_performance(json_str, iterations);
+        test_ccjson_object_index_robustness(20000);
+        test_ccjson_key_lookup_performance(json_str, iterations);
+        test_ccjson_optional_access_performance(json_str, 100);
+        test_ccjson_sax_performance(json_str, iterations);
+        test_ccjson_push_performance(json_str, iterations);
+        test_ccjson_ndjson_performance(generate_ndjson(json_str, 16 * 1024 * 1024));
+        test_ccjson_parallel_performance(generate_large_array(json_str, 16 * 1024 * 1024));
+        test_ccjson_try_parse_performance(json_str, 100);
+        test_ccjson_deep_nesting(1000000);
 
         // 测试序列化性能
         std::cout << "\n--- Stringify Performance ---" << std::endl;
@@ -413,6 +1875,16 @@ int main() {
         std::cout << "\n--- Memory Usage ---" << std::endl;
         test_ccjson_memory_usage(json_str);
         test_nlohmann_memory_usage(json_str);
+        test_ccjson_allocation_count(json_str);
+
+        // 以浮点数为主的文档
+        std::string geometry_str = generate_geometry_json(55000);
+        std::cout << "\n=== Geometry (canada.json-style) Performance Tests ===\n" << std::endl;
+        std::cout << "Geometry json size: " << geometry_str.size() << " bytes" << std::endl;
+        test_ccjson_parse_performance(geometry_str, 50);
+        test_nlohmann_parse_performance(geometry_str, 50);
+        test_float_parse_performance(geometry_str, 20);
+        test_ccjson_lazy_number_performance(geometry_str, 50);
 
         return 0;
     } catch (const std::exception& e) {